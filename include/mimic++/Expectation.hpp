@@ -18,30 +18,152 @@
 #include "mimic++/reporting/ExpectationReport.hpp"
 #include "mimic++/reporting/GlobalReporter.hpp"
 #include "mimic++/reporting/TargetReport.hpp"
+#include "mimic++/utilities/AffineMutex.hpp"
+#include "mimic++/utilities/C++23Backports.hpp"
 #include "mimic++/utilities/Concepts.hpp"
+#include "mimic++/utilities/ParallelFor.hpp"
 #include "mimic++/utilities/SourceLocation.hpp"
+#include "mimic++/utilities/TypeList.hpp"
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
     #include <algorithm>
+    #include <array>
+    #include <atomic>
+    #include <bitset>
     #include <concepts>
+    #include <cstddef>
+    #include <cstdint>
+    #include <exception>
     #include <functional>
+    #include <limits>
     #include <memory>
+    #include <memory_resource>
     #include <mutex>
+    #include <new>
     #include <optional>
     #include <ranges>
+    #include <shared_mutex>
+    #include <span>
+    #include <stdexcept>
+    #include <thread>
     #include <tuple>
+    #include <unordered_map>
     #include <utility>
     #include <vector>
 #endif
 
 namespace mimicpp::detail
 {
+    template <typename Return, typename... Params, typename Signature>
+    void report_matching_failure(
+        reporting::TargetReport const& target,
+        call::Info<Return, Params...> const& call,
+        Expectation<Signature> const& expectation,
+        std::exception_ptr exception) noexcept
+    {
+        reporting::detail::report_unhandled_exception(
+            reporting::make_call_report(
+                target,
+                call,
+                util::stacktrace::current(4u + call.baseStacktraceSkip)),
+            expectation.report(),
+            std::move(exception));
+    }
+
     template <typename Return, typename... Params, typename Signature>
     [[nodiscard]]
-    std::optional<reporting::RequirementOutcomes> determine_requirement_outcomes(
+    bool determine_is_matching(
         reporting::TargetReport const& target,
         call::Info<Return, Params...> const& call,
         Expectation<Signature> const& expectation) noexcept
+    {
+        try
+        {
+            return expectation.is_matching(call);
+        }
+        catch (...)
+        {
+            report_matching_failure(target, call, expectation, std::current_exception());
+        }
+
+        return false;
+    }
+
+    /**
+     * \brief Stores the outcome of an ahead-of-time evaluation of ``Expectation::is_matching``.
+     * \details The reporting of a thrown exception is deferred, thus it's reported in the same order
+     * (and only under the same conditions) as it would be during a sequential evaluation.
+     */
+    class MatchOutcome
+    {
+    public:
+        template <typename Return, typename... Params, typename Signature>
+        void evaluate(
+            call::Info<Return, Params...> const& call,
+            Expectation<Signature> const& expectation) noexcept
+        {
+            try
+            {
+                m_State = expectation.is_matching(call) ? State::matching : State::mismatching;
+            }
+            catch (...)
+            {
+                m_State = State::failed;
+                m_Exception = std::current_exception();
+            }
+        }
+
+        [[nodiscard]]
+        bool is_matching() const noexcept
+        {
+            return State::matching == m_State;
+        }
+
+        /**
+         * \brief Determines the final outcome, as ``determine_is_matching`` would do.
+         * \details Reports a previously thrown exception, or evaluates the expectation, if that hasn't been done yet.
+         */
+        template <typename Return, typename... Params, typename Signature>
+        [[nodiscard]]
+        bool resolve(
+            reporting::TargetReport const& target,
+            call::Info<Return, Params...> const& call,
+            Expectation<Signature> const& expectation) const noexcept
+        {
+            switch (m_State)
+            {
+            case State::matching:
+                return true;
+            case State::mismatching:
+                return false;
+            case State::failed:
+                report_matching_failure(target, call, expectation, m_Exception);
+                return false;
+            case State::unevaluated:
+                break;
+            }
+
+            return determine_is_matching(target, call, expectation);
+        }
+
+    private:
+        enum class State : std::uint8_t
+        {
+            unevaluated,
+            matching,
+            mismatching,
+            failed
+        };
+
+        State m_State{State::unevaluated};
+        std::exception_ptr m_Exception{};
+    };
+
+    template <typename Return, typename... Params, typename Signature>
+    [[nodiscard]]
+    std::optional<reporting::RequirementOutcomes> determine_requirement_outcomes(
+        call::Info<Return, Params...> const& call,
+        Expectation<Signature> const& expectation) noexcept
     {
         try
         {
@@ -49,13 +171,7 @@ namespace mimicpp::detail
         }
         catch (...)
         {
-            reporting::detail::report_unhandled_exception(
-                reporting::make_call_report(
-                    target,
-                    call,
-                    util::stacktrace::current(3u + call.baseStacktraceSkip)),
-                expectation.report(),
-                std::current_exception());
+            // The exception has already been reported by `determine_is_matching`, during the first evaluation.
         }
 
         return std::nullopt;
@@ -87,28 +203,205 @@ namespace mimicpp::detail
         return reports;
     }
 
+    /**
+     * \brief Stores the sequence-ratings of a single expectation.
+     * \details Usually, expectations are attached to just a few sequences, thus the ratings are stored in-place.
+     * Only for expectations with an exceptionally high amount of sequences, this falls back to a dynamic allocation.
+     */
+    class SequenceRatingBuffer
+    {
+    public:
+        template <typename Signature>
+        void assign(Expectation<Signature> const& expectation)
+        {
+            m_Count = expectation.sequence_ratings(m_Inline);
+            if (m_Inline.size() < m_Count)
+            {
+                m_Overflow.resize(m_Count);
+                [[maybe_unused]] std::size_t const count = expectation.sequence_ratings(m_Overflow);
+                MIMICPP_ASSERT(count == m_Count, "Rating count mismatch.");
+            }
+        }
+
+        [[nodiscard]]
+        std::span<sequence::rating const> view() const noexcept
+        {
+            if (m_Count <= m_Inline.size())
+            {
+                return std::span{m_Inline}.first(m_Count);
+            }
+
+            return m_Overflow;
+        }
+
+    private:
+        std::array<sequence::rating, 4u> m_Inline{};
+        std::size_t m_Count{};
+        std::vector<sequence::rating> m_Overflow{};
+    };
+
+    template <typename ControlPolicy>
+    [[nodiscard]]
+    constexpr bool query_is_applicable(ControlPolicy const& policy)
+    {
+        if constexpr (requires { { policy.is_applicable() } -> util::boolean_testable; })
+        {
+            return policy.is_applicable();
+        }
+        else
+        {
+            return std::holds_alternative<reporting::state_applicable>(policy.state());
+        }
+    }
+
+    template <typename ControlPolicy>
     [[nodiscard]]
-    constexpr auto find_best_match(std::span<reporting::ExpectationReport const> const matches)
+    constexpr bool query_is_saturated(ControlPolicy const& policy)
     {
-        constexpr auto ratings = [](auto const& el) noexcept -> const auto& {
-            return std::get<reporting::state_applicable>(el.controlReport)
-                .sequenceRatings;
-        };
+        if constexpr (requires { { policy.is_saturated() } -> util::boolean_testable; })
+        {
+            return policy.is_saturated();
+        }
+        else
+        {
+            return std::holds_alternative<reporting::state_saturated>(policy.state());
+        }
+    }
 
-        auto best = std::ranges::begin(matches);
-        for (auto iter = best + 1;
-             iter != std::ranges::end(matches);
-             ++iter)
+    template <typename ControlPolicy>
+    [[nodiscard]]
+    std::size_t query_sequence_ratings(ControlPolicy const& policy, std::span<sequence::rating> const buffer)
+    {
+        if constexpr (requires { { policy.sequence_ratings(buffer) } -> std::convertible_to<std::size_t>; })
+        {
+            return policy.sequence_ratings(buffer);
+        }
+        else
         {
-            if (!sequence::detail::has_better_rating(
-                    ratings(*best),
-                    ratings(*iter)))
+            // Fallback for control-policies, which are not able to provide the ratings directly.
+            reporting::control_state_t const state = policy.state();
+            auto const& ratings = std::get<reporting::state_applicable>(state).sequenceRatings;
+            if (ratings.size() <= buffer.size())
             {
-                best = iter;
+                std::ranges::copy(ratings, buffer.begin());
             }
+
+            return ratings.size();
+        }
+    }
+
+    template <typename ControlPolicy>
+    [[nodiscard]]
+    constexpr std::size_t query_sequence_count([[maybe_unused]] ControlPolicy const& policy) noexcept
+    {
+        if constexpr (requires { { ControlPolicy::sequenceCount } -> std::convertible_to<std::size_t>; })
+        {
+            return ControlPolicy::sequenceCount;
+        }
+        else
+        {
+            return 0u;
+        }
+    }
+
+    template <typename ControlPolicy>
+    [[nodiscard]]
+    constexpr std::optional<sequence::position> query_strict_sequence_position(ControlPolicy const& policy) noexcept
+    {
+        if constexpr (requires { { policy.strict_sequence_position() } noexcept -> std::convertible_to<std::optional<sequence::position>>; })
+        {
+            return policy.strict_sequence_position();
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    template <typename Signature, typename Policy>
+    [[nodiscard]]
+    constexpr std::optional<std::size_t> query_index_key(Policy const& policy)
+    {
+        if constexpr (requires { { policy.template index_key<Signature>() } -> std::convertible_to<std::optional<std::size_t>>; })
+        {
+            return policy.template index_key<Signature>();
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    template <typename Policy>
+    [[nodiscard]]
+    constexpr Constness query_constness([[maybe_unused]] Policy const& policy) noexcept
+    {
+        if constexpr (requires { { policy.expected_constness() } noexcept -> std::convertible_to<Constness>; })
+        {
+            return policy.expected_constness();
+        }
+        else
+        {
+            return Constness::any;
+        }
+    }
+
+    template <typename Policy>
+    [[nodiscard]]
+    constexpr ValueCategory query_value_category([[maybe_unused]] Policy const& policy) noexcept
+    {
+        if constexpr (requires { { policy.expected_category() } noexcept -> std::convertible_to<ValueCategory>; })
+        {
+            return policy.expected_category();
+        }
+        else
+        {
+            return ValueCategory::any;
+        }
+    }
+
+    template <typename Policy>
+    [[nodiscard]]
+    constexpr bool query_is_fallback([[maybe_unused]] Policy const& policy) noexcept
+    {
+        if constexpr (requires { { policy.is_fallback() } noexcept -> util::boolean_testable; })
+        {
+            return policy.is_fallback();
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    /**
+     * \brief Determines, whether calls of the given signature can be looked up by the hash of their first argument.
+     */
+    template <typename Signature>
+    concept first_arg_indexable = 0u < signature_param_list_t<Signature>::size
+                               && util::hashable<std::remove_cvref_t<signature_param_type_t<0u, Signature>>>;
+
+    template <typename Signature>
+        requires first_arg_indexable<Signature>
+    [[nodiscard]]
+    std::size_t hash_first_arg(call::info_for_signature_t<Signature> const& call)
+    {
+        using ValueT = std::remove_cvref_t<signature_param_type_t<0u, Signature>>;
+
+        return std::hash<ValueT>{}(std::get<0>(call.args).get());
+    }
+
+    template <std::size_t count>
+    [[nodiscard]]
+    std::vector<bool> to_outcome_vector(std::bitset<count> const& outcomes)
+    {
+        std::vector<bool> result(count);
+        for (std::size_t i{}; i < count; ++i)
+        {
+            result[i] = outcomes.test(i);
         }
 
-        return std::ranges::distance(std::ranges::begin(matches), best);
+        return result;
     }
 }
 
@@ -209,14 +502,89 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         [[nodiscard]]
         virtual bool is_applicable() const noexcept = 0;
 
+        /**
+         * \brief Queries the control policy, whether it's saturated.
+         * \return Returns true, if expectation is saturated.
+         * \details A saturated expectation will never become applicable again.
+         */
+        [[nodiscard]]
+        virtual bool is_saturated() const noexcept = 0;
+
         /**
          * \brief Queries all policies, whether they accept the given call.
          * \param call The call to be matched.
-         * \return Returns true, if all policies accept the call.
+         * \return Returns the outcomes of all policies.
          */
         [[nodiscard]]
         virtual reporting::RequirementOutcomes matches(const CallInfoT& call) const = 0;
 
+        /**
+         * \brief Queries all policies, whether they accept the given call.
+         * \param call The call to be matched.
+         * \return Returns true, if all policies accept the call.
+         * \details In contrast to ``matches``, this function must not allocate, as it's used on the hot path of each call.
+         * Implementations are free to stop at the first policy, which rejects the call.
+         */
+        [[nodiscard]]
+        virtual bool is_matching(const CallInfoT& call) const = 0;
+
+        /**
+         * \brief Returns the amount of sequences, this expectation is attached to.
+         * \return The sequence count.
+         * \note This value must not change during the lifetime of the expectation.
+         */
+        [[nodiscard]]
+        virtual std::size_t sequence_count() const noexcept = 0;
+
+        /**
+         * \brief Writes the sequence-ratings into the given buffer.
+         * \param buffer The destination.
+         * \return The total amount of ratings.
+         * \details The ratings are only written, when the buffer is large enough to hold all of them.
+         * Otherwise, the buffer remains untouched and callers should retry with a buffer of the returned size.
+         * This function must not allocate, as it's used on the hot path of each call.
+         * \attention Calling this function on an inapplicable expectation is undefined behavior.
+         */
+        [[nodiscard]]
+        virtual std::size_t sequence_ratings(std::span<sequence::rating> buffer) const = 0;
+
+        /**
+         * \brief Returns the position within the only sequence, this expectation is attached to.
+         * \return The position, or ``std::nullopt``.
+         * \details A position is only provided, when the expectation is attached to exactly one sequence and must be matched
+         * an exact (non-zero) amount of times. Such an expectation blocks all its successors within that sequence, until
+         * it's saturated.
+         * \note This value must not change during the lifetime of the expectation.
+         */
+        [[nodiscard]]
+        virtual std::optional<sequence::position> strict_sequence_position() const noexcept = 0;
+
+        /**
+         * \brief Returns the key, by which this expectation can be looked up.
+         * \return The hash of the value, the first argument is required to compare equal to, or ``std::nullopt``.
+         * \details When a key is provided, calls whose first argument hashes differently are guaranteed not to match.
+         * \note This value must not change during the lifetime of the expectation.
+         */
+        [[nodiscard]]
+        virtual std::optional<std::size_t> index_key() const = 0;
+
+        /**
+         * \brief Returns the overload-qualifications, from which this expectation accepts calls.
+         * \return The accepted constness and value-category.
+         * \details Calls from overloads, which are qualified differently, are guaranteed not to match.
+         * \note This value must not change during the lifetime of the expectation.
+         */
+        [[nodiscard]]
+        virtual std::tuple<Constness, ValueCategory> qualification() const noexcept = 0;
+
+        /**
+         * \brief Determines, whether this expectation is a fallback.
+         * \return ``true``, if it shall only be considered, when no regular expectation is applicable.
+         * \note This value must not change during the lifetime of the expectation.
+         */
+        [[nodiscard]]
+        virtual bool is_fallback() const noexcept = 0;
+
         /**
          * \brief Informs all policies, that the given call has been accepted.
          * \param call The call to be consumed.
@@ -248,6 +616,37 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         virtual constexpr StringT const& mock_name() const noexcept = 0;
     };
 
+    /**
+     * \brief The construction-settings of an ``ExpectationCollection``.
+     * \details Mocks populate these from their ``MockSettings``.
+     */
+    struct ExpectationCollectionSettings
+    {
+        /**
+         * \brief Determines, from which threads the collection may be used.
+         */
+        ThreadAffinity threadAffinity{ThreadAffinity::any};
+
+        /**
+         * \brief Determines, that just every n-th call is fully verified. ``0`` and ``1`` verify each call.
+         * \details See the "Sampled verification" section of ``ExpectationCollection::handle_call`` for details.
+         */
+        std::size_t verificationInterval{1u};
+
+        /**
+         * \brief The memory-resource, which is used for the internal storage and the expectations.
+         * \details ``nullptr`` selects the current ``settings::memory_resource``.
+         * \attention The resource must outlive the collection and all of its expectations.
+         */
+        std::pmr::memory_resource* memoryResource{};
+
+        /**
+         * \brief Determines, how concurrent calls are handled.
+         * \details See the "Thread-Safety" section of ``ExpectationCollection::handle_call`` for details.
+         */
+        CallConcurrency callConcurrency{CallConcurrency::serialized};
+    };
+
     /**
      * \brief Collects all expectations for a specific (decayed) signature.
      * \tparam Signature The decayed signature.
@@ -283,6 +682,23 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         [[nodiscard]]
         ExpectationCollection() = default;
 
+        /**
+         * \brief Constructs the collection with the given settings.
+         * \param settings The settings.
+         * \details When bound to the ``ThreadAffinity::owner``, the collection must exclusively be used by the
+         * constructing thread. All internal synchronization is then skipped; debug-builds report each operation,
+         * which isn't performed on the owning thread, as error.
+         */
+        [[nodiscard]]
+        explicit ExpectationCollection(ExpectationCollectionSettings const& settings) noexcept
+            : m_MemoryResource{detail::select_memory_resource(settings.memoryResource)},
+              m_VerificationInterval{settings.verificationInterval},
+              m_Concurrency{settings.callConcurrency},
+              m_ExpectationsMx{settings.threadAffinity},
+              m_StateMx{settings.threadAffinity}
+        {
+        }
+
         /**
          * \brief Deleted copy-constructor.
          */
@@ -304,128 +720,1433 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
          */
         ExpectationCollection& operator=(ExpectationCollection&&) = default;
 
+        /**
+         * \brief Queries the thread-affinity of this collection.
+         * \return The thread-affinity.
+         */
+        [[nodiscard]]
+        ThreadAffinity thread_affinity() const noexcept
+        {
+            return m_StateMx.is_confined() ? ThreadAffinity::owner : ThreadAffinity::any;
+        }
+
+        /**
+         * \brief Queries the memory-resource, which is used by this collection.
+         * \return The used memory-resource.
+         */
+        [[nodiscard]]
+        std::pmr::memory_resource* memory_resource() const noexcept
+        {
+            return m_MemoryResource;
+        }
+
+        /**
+         * \brief A stable handle to an expectation, which has been inserted into a collection.
+         * \details Handles are cheap to copy and enable the removal of the related expectation in constant time.
+         */
+        class Handle
+        {
+        public:
+            /**
+             * \brief Default constructor, creating an invalid handle.
+             */
+            [[nodiscard]]
+            constexpr Handle() = default;
+
+            /**
+             * \brief Defaulted equality-comparison.
+             */
+            [[nodiscard]]
+            friend constexpr bool operator==(Handle const&, Handle const&) = default;
+
+        private:
+            friend class ExpectationCollection;
+
+            std::size_t m_Index{npos};
+            std::size_t m_Generation{};
+
+            [[nodiscard]]
+            explicit constexpr Handle(std::size_t const index, std::size_t const generation) noexcept
+                : m_Index{index},
+                  m_Generation{generation}
+            {
+            }
+        };
+
         /**
          * \brief Inserts the given expectation into the internal storage.
          * \param expectation The expectation to be inserted.
+         * \return A handle, which must be used for the removal.
          * \attention Inserting an expectation, which is already element of any ExpectationCollection (including the current one),
          * is undefined behavior.
          */
-        void push(std::shared_ptr<ExpectationT> expectation)
+        Handle push(std::shared_ptr<ExpectationT> expectation)
         {
-            const std::scoped_lock lock{m_ExpectationsMx};
+            MIMICPP_ASSERT(expectation, "Expectation is nullptr.");
+
+            Insertion insertion = prepare_insertion(std::move(expectation));
 
-            MIMICPP_ASSERT(std::ranges::find(m_Expectations, expectation) == std::ranges::end(m_Expectations), "Expectation already belongs to this storage.");
+            std::unique_lock const lock{m_ExpectationsMx};
+            Handle const handle = insert(std::move(insertion));
+            invalidate_cached_matches();
 
-            m_Expectations.emplace_back(std::move(expectation));
+            return handle;
         }
 
         /**
-         * \brief Removes the given expectation from the internal storage.
-         * \param expectation The expectation to be removed.
-         * \details This function also checks, whether the removed expectation is satisfied. If not, an
-         * "unfulfilled expectation"- report is emitted.
-         * \attention Removing an expectation, which is not element of the current ExpectationCollection, is undefined behavior.
+         * \brief Inserts all given expectations into the internal storage at once.
+         * \param expectations The expectations to be inserted.
+         * \return The handles of the inserted expectations, in the same order.
+         * \details The internal storage is reserved and locked just once for all expectations.
+         * Either all or none of the expectations are inserted. The handles are allocated from the ``memory_resource``.
+         * \attention Inserting an expectation, which is already element of any ExpectationCollection (including the current one),
+         * is undefined behavior.
          */
-        void remove(std::shared_ptr<ExpectationT> expectation)
+        std::pmr::vector<Handle> push(std::span<std::shared_ptr<ExpectationT> const> const expectations)
         {
-            const std::scoped_lock lock{m_ExpectationsMx};
+            std::pmr::vector<Insertion> insertions{m_MemoryResource};
+            insertions.reserve(expectations.size());
+            for (auto const& expectation : expectations)
+            {
+                MIMICPP_ASSERT(expectation, "Expectation is nullptr.");
+                insertions.emplace_back(prepare_insertion(expectation));
+            }
+
+            std::pmr::vector<Handle> handles{m_MemoryResource};
+            handles.reserve(insertions.size());
 
-            auto iter = std::ranges::find(m_Expectations, expectation);
-            MIMICPP_ASSERT(iter != std::ranges::end(m_Expectations), "Expectation does not belong to this storage.");
-            m_Expectations.erase(iter);
+            std::unique_lock const lock{m_ExpectationsMx};
+            reserve_slots(insertions.size());
+            try
+            {
+                for (Insertion& insertion : insertions)
+                {
+                    handles.emplace_back(insert(std::move(insertion)));
+                }
+            }
+            catch (...)
+            {
+                for (Handle const& handle : handles)
+                {
+                    erase(handle);
+                }
+
+                throw;
+            }
+
+            invalidate_cached_matches();
+
+            return handles;
+        }
+
+        /**
+         * \brief Removes the referenced expectation from the internal storage.
+         * \param handle The handle of the expectation to be removed.
+         * \details This function also checks, whether the removed expectation is satisfied. If not, an
+         * "unfulfilled expectation"- report is emitted.
+         * Expectations, which have already been removed via ``clear``, are ignored.
+         * \attention Removing an expectation, which is not element of the current ExpectationCollection, is undefined behavior.
+         */
+        void remove(Handle const handle)
+        {
+            std::unique_lock const lock{m_ExpectationsMx};
+
+            if (is_cleared(handle))
+            {
+                return;
+            }
+
+            std::shared_ptr<ExpectationT> const expectation = erase(handle);
+            if (!expectation->is_satisfied())
+            {
+                reporting::detail::report_unfulfilled_expectation(
+                    expectation->report());
+            }
+        }
+
+        /**
+         * \brief Removes all referenced expectations from the internal storage at once.
+         * \param handles The handles of the expectations to be removed.
+         * \details The storage is locked just once for all expectations.
+         * All of them are removed, before the unsatisfied ones are reported (in the given order) as "unfulfilled expectation".
+         * Thus, the storage is consistent, even if a report aborts via an exception.
+         * \attention Removing an expectation, which is not element of the current ExpectationCollection, is undefined behavior.
+         */
+        void remove(std::span<Handle const> const handles)
+        {
+            std::pmr::vector<std::shared_ptr<ExpectationT>> unfulfilled{m_MemoryResource};
+            {
+                std::unique_lock const lock{m_ExpectationsMx};
+
+                // Reserves upfront, thus the removal itself can not fail.
+                std::size_t const unfulfilledCount = std::ranges::count_if(
+                    handles,
+                    [&](Handle const& handle) {
+                        return !is_cleared(handle)
+                            && !owned_slot(handle).expectation->is_satisfied();
+                    });
+                unfulfilled.reserve(unfulfilledCount);
+
+                for (Handle const& handle : handles)
+                {
+                    if (is_cleared(handle))
+                    {
+                        continue;
+                    }
+
+                    if (std::shared_ptr<ExpectationT> expectation = erase(handle);
+                        !expectation->is_satisfied())
+                    {
+                        unfulfilled.emplace_back(std::move(expectation));
+                    }
+                }
+            }
+
+            report_unfulfilled(unfulfilled);
+        }
+
+        /**
+         * \brief Removes all expectations from the internal storage.
+         * \details All expectations are removed at once, before the unsatisfied ones are reported (in order of construction)
+         * as "unfulfilled expectation". Thus, the storage is consistent, even if a report aborts via an exception.
+         * The owners of the removed expectations (e.g. ``ScopedExpectation``) stay valid, but their removal is then a no-op.
+         * The internal storage is kept, thus it can be reused by subsequent expectations without allocating again.
+         */
+        void clear()
+        {
+            report_unfulfilled(release_all());
+        }
+
+        /**
+         * \brief Removes all expectations from the internal storage, without reporting them.
+         * \return The removed unsatisfied expectations, in order of construction.
+         * \details This behaves like ``clear``, but leaves the reporting of the unsatisfied expectations to the caller.
+         * Thus, multiple collections can be cleared at once, before anything is reported.
+         */
+        [[nodiscard]]
+        std::pmr::vector<std::shared_ptr<ExpectationT>> release_all()
+        {
+            std::pmr::vector<std::shared_ptr<ExpectationT>> unfulfilled{m_MemoryResource};
+            {
+                std::unique_lock const lock{m_ExpectationsMx};
+
+                // Reserves upfront, thus the removal itself can not fail.
+                std::size_t unfulfilledCount{};
+                for (std::size_t index = m_All.head; npos != index; index = m_Slots[index].all.next)
+                {
+                    if (!m_Slots[index].expectation->is_satisfied())
+                    {
+                        ++unfulfilledCount;
+                    }
+                }
+                unfulfilled.reserve(unfulfilledCount);
+
+                while (npos != m_All.head)
+                {
+                    Handle const handle{m_All.head, m_Slots[m_All.head].generation};
+                    if (std::shared_ptr<ExpectationT> expectation = erase(handle);
+                        !expectation->is_satisfied())
+                    {
+                        unfulfilled.emplace_back(std::move(expectation));
+                    }
+                }
+            }
+
+            return unfulfilled;
+        }
+
+        /**
+         * \brief Reports each of the given expectations as "unfulfilled expectation".
+         * \param expectations The expectations to be reported.
+         */
+        static void report_unfulfilled(std::span<std::shared_ptr<ExpectationT> const> const expectations)
+        {
+            for (auto const& expectation : expectations)
+            {
+                reporting::detail::report_unfulfilled_expectation(
+                    expectation->report());
+            }
+        }
+
+        /**
+         * \brief Handles the incoming call.
+         * \param target The mock-target, which received the call.
+         * \param call The call to be handled.
+         * \return Returns an appropriate result from the matched expectation.
+         * \details This function queries all stored expectations, whether they accept the call.
+         * If multiple matches are possible, the best match is selected and a "matched"-report is emitted.
+         * If no matches are found, "no matched"-report is emitted and the call is aborted (e.g. by throwing an exception or terminating).
+         * If matches are possible, but all expectations are saturated, an "inapplicable match"-report is emitted.
+         *
+         * # Thread-Safety
+         * Calls may be handled concurrently. By default (``CallConcurrency::serialized``), each call is handled under
+         * exclusive access, thus the requirements of the stored expectations (e.g. the argument matchers) are never
+         * evaluated concurrently.
+         *
+         * With ``CallConcurrency::optimistic``, the requirements are evaluated in parallel, thus they must not rely on
+         * any unsynchronized mutable state. Everything, which depends on the current state of an expectation (its
+         * applicability and the consumption), is still strictly serialized; the selected expectation is guaranteed to be
+         * applicable when it gets consumed. As long as any expectation of this collection is attached to a sequence, the
+         * whole selection is serialized, because sequences are not thread-safe.
+         *
+         * Collections, which are bound to their owning thread, skip all of that synchronization.
+         *
+         * # Finalization
+         * The finalizer of the selected expectation runs after the storage has been released, as it may execute arbitrary
+         * user code (e.g. calling into the same mock again). The relative order of reporting, consumption and
+         * finalization is kept, thus a throwing finalizer still observes an already reported and consumed expectation.
+         * No lock is held while a finalizer runs, thus it may block (e.g. wait for other threads calling the same mock)
+         * without stalling or dead-locking the other calls. As a consequence, finalizers (even of the same expectation)
+         * may run concurrently, when the mock is called from multiple threads. Stateful finalizers must synchronize
+         * themselves.
+         *
+         * # Retirement
+         * An expectation, which became saturated by the call, is retired before it gets finalized. Expectations, which are
+         * already saturated when they are pushed, are retired immediately. Retired expectations are no longer considered
+         * during the selection, but still contribute to the inapplicable-match diagnostics.
+         *
+         * # Sampled verification
+         * When constructed with a verification-interval greater than one, just every n-th call is fully verified.
+         * All other calls are directly dispatched to the most recently verified expectation, as long as that's still
+         * applicable and compatible with the call (its overload-qualification and index-key). Its requirements are then
+         * not evaluated and no "matched"-report is emitted, but it's consumed as usual; thus all times-checks stay intact.
+         * If no such expectation exists, the call is fully verified instead.
+         * This is not applied, while any expectation is attached to a sequence.
+         * \attention Unverified calls may be dispatched to an expectation, whose requirements they don't satisfy.
+         */
+        [[nodiscard]]
+        ReturnT handle_call(reporting::TargetReport const& target, CallInfoT call)
+        {
+            std::size_t const stacktraceSkip{1u + call.baseStacktraceSkip};
+
+            // Keeps the selected expectation alive, even if it gets removed while it's finalized.
+            std::shared_ptr<ExpectationT> selected{};
+            Handle selectedHandle{};
+            bool isRetirementPending{};
+            {
+                // Optimistic calls share the storage and just serialize the state; all others require exclusive access.
+                bool const isOptimistic = CallConcurrency::optimistic == m_Concurrency;
+                std::shared_lock sharedLock{m_ExpectationsMx, std::defer_lock};
+                std::unique_lock exclusiveLock{m_ExpectationsMx, std::defer_lock};
+                if (isOptimistic)
+                {
+                    sharedLock.lock();
+                }
+                else
+                {
+                    exclusiveLock.lock();
+                }
+                StateLock stateLock{m_StateMx, !isOptimistic};
+
+                std::size_t match = find_unverified_match(call, stateLock);
+                bool const isVerified = npos == match;
+                if (isVerified)
+                {
+                    match = find_best_match(target, call, stateLock);
+                }
+
+                if (npos != match)
+                {
+                    MIMICPP_ASSERT(stateLock.owns_lock(), "The state must be locked, when a match has been selected.");
+
+                    Slot const& slot = m_Slots[match];
+                    ExpectationT& expectation = *slot.expectation;
+                    if (isVerified
+                        && 1u < m_VerificationInterval)
+                    {
+                        m_LastVerified.store(match, std::memory_order_relaxed);
+                    }
+
+                    if (isVerified
+                        && settings::report_success())
+                    {
+                        // Todo: Avoid the call copy
+                        // Maybe we can prevent the copy here, but we should keep the instruction order as-is, because
+                        // in cases of a throwing finalizer, we might introduce bugs. At least there are some tests, which
+                        // will fail if done wrong.
+                        reporting::detail::report_full_match(
+                            reporting::make_call_report(target, call, util::stacktrace::current(stacktraceSkip)),
+                            expectation.report());
+                    }
+
+                    expectation.consume(call);
+                    selected = slot.expectation;
+                    if (expectation.is_saturated())
+                    {
+                        // Retiring requires exclusive access, which a shared call has to acquire afterward.
+                        if (isOptimistic)
+                        {
+                            isRetirementPending = true;
+                            selectedHandle = Handle{match, slot.generation};
+                        }
+                        else
+                        {
+                            deactivate(match);
+                        }
+                    }
+                }
+                else
+                {
+                    // No applicable match exists, thus we have to build the diagnostics.
+                    // Only here we are allowed to allocate.
+                    if (!stateLock.owns_lock())
+                    {
+                        stateLock.lock();
+                    }
+
+                    std::vector<ExpectationT*> inapplicableMatches{};
+                    std::vector<std::tuple<ExpectationT*, reporting::RequirementOutcomes>> noMatches{};
+                    evaluate_expectations(call, inapplicableMatches, noMatches);
+
+                    if (!std::ranges::empty(inapplicableMatches))
+                    {
+                        reporting::detail::report_inapplicable_matches(
+                            reporting::make_call_report(target, std::move(call), util::stacktrace::current(stacktraceSkip)),
+                            detail::gather_expectation_reports(inapplicableMatches));
+                    }
+
+                    reporting::detail::report_no_matches(
+                        reporting::make_call_report(target, std::move(call), util::stacktrace::current(stacktraceSkip)),
+                        detail::make_no_match_reports(std::move(noMatches)));
+                }
+            }
+
+            if (isRetirementPending)
+            {
+                retire(selectedHandle);
+            }
+
+            return selected->finalize_call(call);
+        }
+
+    private:
+        static constexpr std::size_t npos{std::numeric_limits<std::size_t>::max()};
+
+        struct Links
+        {
+            std::size_t prev{npos};
+            std::size_t next{npos};
+        };
+
+        struct List
+        {
+            std::size_t head{npos};
+            std::size_t tail{npos};
+        };
+
+        struct Slot
+        {
+            std::shared_ptr<ExpectationT> expectation{};
+            std::size_t generation{};
+            std::size_t id{};
+            std::optional<std::size_t> key{};
+            std::size_t partition{};
+            bool isFallback{};
+            sequence::position position{};
+            bool isSequenced{};
+            bool isQueued{};
+            bool isActive{};
+            Links all{};
+            Links hot{};
+            Links queue{};
+        };
+
+        // All internal storage is allocated from this resource.
+        std::pmr::memory_resource* m_MemoryResource{detail::select_memory_resource(nullptr)};
+        // The expectations are stored in reusable slots, which are linked into intrusive lists.
+        // The slot-index together with the generation forms the handle, thus removals are done in constant time.
+        std::pmr::vector<Slot> m_Slots{m_MemoryResource};
+        std::pmr::vector<std::size_t> m_FreeSlots{m_MemoryResource};
+        // All expectations (including the retired ones) in order of construction; only used for the diagnostics.
+        List m_All{};
+        // The active expectations are partitioned by the overload-qualifications, they accept calls from.
+        // The hot path only considers the partitions, which are compatible with the call. Of each, just the unindexed
+        // expectations and the bucket of the actual first argument are visited.
+        // All of these are ordered by their ids, thus they can be merged in reverse order of construction.
+        // Saturated expectations are retired from these, as they can never be applicable again.
+        // Fallback expectations are kept in a separate tier, which is only visited after the regular one.
+        struct Partition
+        {
+            using IndexT = std::pmr::unordered_map<std::size_t, List>;
+
+            [[nodiscard]]
+            explicit Partition(std::pmr::memory_resource* const resource)
+                : index{resource}
+            {
+            }
+
+            List unindexed{};
+            IndexT index;
+            // The most recently released index-node, which is reused for the next new key.
+            typename IndexT::node_type spareNode{};
+        };
+
+        // Constness and value-category both have three (non-empty) states.
+        static constexpr std::size_t partitionCount{3u * 3u};
+        using TierT = std::array<Partition, partitionCount>;
+        std::array<TierT, 2u> m_Tiers{make_tier(m_MemoryResource), make_tier(m_MemoryResource)};
+        std::size_t m_IndexedCount{};
+        std::size_t m_NextId{};
+        std::size_t m_SequencedCount{};
+        // The active expectations, which provide a strict sequence-position, in order of construction.
+        // When all active expectations are part of it and their positions are ascending within the same sequence,
+        // only its head can ever be applicable.
+        List m_Queue{};
+        std::size_t m_UnqueuedCount{};
+        bool m_IsQueueOrdered{true};
+        // The slot-index of the last winner (per call-qualification), which is known to be preferred over all its
+        // younger candidates. They are reset by each push; stores are only done while the storage is shared-locked.
+        std::array<std::atomic<std::size_t>, partitionCount> m_LastWinners{make_last_winners()};
+        // Only every n-th call is fully verified; the others are dispatched to the most recently verified expectation.
+        std::size_t m_VerificationInterval{1u};
+        std::atomic<std::size_t> m_CallCount{};
+        std::atomic<std::size_t> m_LastVerified{npos};
+        CallConcurrency m_Concurrency{CallConcurrency::serialized};
+        // Guards the storage itself. Optimistic calls share it, while all other operations require exclusive access.
+        util::detail::AffineMutex<std::shared_mutex> m_ExpectationsMx{};
+        // Serializes everything, which observes or mutates the state of the stored expectations during shared calls.
+        using StateMutexT = util::detail::AffineMutex<std::mutex>;
+        StateMutexT m_StateMx{};
+
+        // The storage of an ahead-of-time evaluation.
+        struct OutcomeBuffer
+        {
+            [[nodiscard]]
+            explicit OutcomeBuffer(std::pmr::memory_resource* const resource)
+                : candidates{resource},
+                  outcomes{resource}
+            {
+            }
+
+            std::pmr::vector<std::size_t> candidates;
+            std::pmr::vector<detail::MatchOutcome> outcomes;
+        };
+
+        // Reused by all parallel evaluations, unless it's already occupied by a concurrent (or nested) one.
+        mutable OutcomeBuffer m_OutcomeBuffer{m_MemoryResource};
+        mutable std::atomic_flag m_IsOutcomeBufferLeased{};
+
+        /**
+         * \brief Provides the buffer for a single ahead-of-time evaluation.
+         * \details The buffer of the collection is acquired on demand. If that's already leased, a temporary buffer is
+         * used instead. The acquired buffer is released (but keeps its capacity) when the lease gets destroyed.
+         */
+        class OutcomeBufferLease
+        {
+        public:
+            ~OutcomeBufferLease() noexcept
+            {
+                if (m_Buffer == &m_Owner->m_OutcomeBuffer)
+                {
+                    m_Buffer->candidates.clear();
+                    m_Buffer->outcomes.clear();
+                    m_Owner->m_IsOutcomeBufferLeased.clear(std::memory_order_release);
+                }
+            }
+
+            [[nodiscard]]
+            explicit OutcomeBufferLease(ExpectationCollection const& owner) noexcept
+                : m_Owner{&owner}
+            {
+            }
+
+            OutcomeBufferLease(OutcomeBufferLease const&) = delete;
+            OutcomeBufferLease& operator=(OutcomeBufferLease const&) = delete;
+            OutcomeBufferLease(OutcomeBufferLease&&) = delete;
+            OutcomeBufferLease& operator=(OutcomeBufferLease&&) = delete;
+
+            [[nodiscard]]
+            OutcomeBuffer& acquire()
+            {
+                if (!m_Buffer)
+                {
+                    if (!m_Owner->m_IsOutcomeBufferLeased.test_and_set(std::memory_order_acquire))
+                    {
+                        m_Buffer = &m_Owner->m_OutcomeBuffer;
+                    }
+                    else
+                    {
+                        m_Buffer = &m_Temporary.emplace(m_Owner->m_MemoryResource);
+                    }
+                }
+
+                return *m_Buffer;
+            }
+
+        private:
+            ExpectationCollection const* m_Owner;
+            OutcomeBuffer* m_Buffer{};
+            std::optional<OutcomeBuffer> m_Temporary{};
+        };
+
+        /**
+         * \brief Guards the state of the stored expectations during a single call.
+         * \details When the call is handled under exclusive access, the state is implicitly guarded for the whole call,
+         * thus all operations are no-ops.
+         */
+        class StateLock
+        {
+        public:
+            [[nodiscard]]
+            explicit StateLock(StateMutexT& mutex, bool const isExclusive) noexcept
+                : m_Lock{mutex, std::defer_lock},
+                  m_IsExclusive{isExclusive}
+            {
+            }
+
+            void lock()
+            {
+                if (!m_IsExclusive)
+                {
+                    m_Lock.lock();
+                }
+            }
+
+            void unlock()
+            {
+                if (!m_IsExclusive)
+                {
+                    m_Lock.unlock();
+                }
+            }
+
+            [[nodiscard]]
+            bool owns_lock() const noexcept
+            {
+                return m_IsExclusive || m_Lock.owns_lock();
+            }
+
+        private:
+            std::unique_lock<StateMutexT> m_Lock;
+            bool m_IsExclusive;
+        };
+
+        // Everything of an expectation, which is required for its insertion and can be queried without the storage lock.
+        struct Insertion
+        {
+            std::shared_ptr<ExpectationT> expectation;
+            std::optional<std::size_t> key;
+            std::optional<sequence::position> position;
+            std::size_t partition;
+            bool isFallback;
+        };
+
+        [[nodiscard]]
+        static Insertion prepare_insertion(std::shared_ptr<ExpectationT> expectation)
+        {
+            std::optional const key = lookup_key(*expectation);
+            std::optional const position = expectation->strict_sequence_position();
+            auto const [constness, category] = expectation->qualification();
+            bool const isFallback = expectation->is_fallback();
+
+            return Insertion{
+                .expectation = std::move(expectation),
+                .key = key,
+                .position = position,
+                .partition = partition_of(constness, category),
+                .isFallback = isFallback};
+        }
+
+        /**
+         * \brief Makes sure, that the given amount of expectations can be inserted without reallocating the slots.
+         */
+        void reserve_slots(std::size_t const count)
+        {
+            std::size_t const required = m_Slots.size() + (count - std::min(count, m_FreeSlots.size()));
+            if (m_Slots.capacity() < required)
+            {
+                m_Slots.reserve(std::max(required, 2u * m_Slots.size()));
+            }
+
+            if (m_FreeSlots.capacity() < required)
+            {
+                m_FreeSlots.reserve(std::max(required, 2u * m_Slots.size()));
+            }
+        }
+
+        /**
+         * \brief Inserts the prepared expectation. The storage must be exclusively locked.
+         */
+        [[nodiscard]]
+        Handle insert(Insertion&& insertion)
+        {
+            // Everything, which may throw, is done upfront, thus the linkage itself can not fail.
+            Partition& partition = m_Tiers[insertion.isFallback ? 1u : 0u][insertion.partition];
+            List& hotList = insertion.key ? acquire_bucket(partition, *insertion.key) : partition.unindexed;
+            std::size_t index{};
+            if (!m_FreeSlots.empty())
+            {
+                index = m_FreeSlots.back();
+                m_FreeSlots.pop_back();
+            }
+            else
+            {
+                // Makes sure, that removals never have to allocate.
+                // The growth is geometric, thus pushing stays amortized allocation-free.
+                if (m_FreeSlots.capacity() <= m_Slots.size())
+                {
+                    m_FreeSlots.reserve(std::max<std::size_t>(8u, 2u * m_Slots.size()));
+                }
+
+                index = m_Slots.size();
+                m_Slots.emplace_back();
+            }
+
+            Slot& slot = m_Slots[index];
+            slot.id = m_NextId++;
+            slot.key = insertion.key;
+            slot.partition = insertion.partition;
+            slot.isFallback = insertion.isFallback;
+            slot.isSequenced = 0u != insertion.expectation->sequence_count();
+            slot.isQueued = insertion.position.has_value();
+            slot.expectation = std::move(insertion.expectation);
+            link_back<&Slot::all>(m_All, index);
+            link_back<&Slot::hot>(hotList, index);
+            slot.isActive = true;
+
+            if (slot.isSequenced)
+            {
+                ++m_SequencedCount;
+            }
+
+            if (slot.key)
+            {
+                ++m_IndexedCount;
+            }
+
+            if (slot.isQueued)
+            {
+                if (npos != m_Queue.tail)
+                {
+                    sequence::position const& last = m_Slots[m_Queue.tail].position;
+                    m_IsQueueOrdered = m_IsQueueOrdered
+                                    && last.tag == insertion.position->tag
+                                    && last.index < insertion.position->index;
+                }
+
+                slot.position = *insertion.position;
+                link_back<&Slot::queue>(m_Queue, index);
+            }
+            else
+            {
+                ++m_UnqueuedCount;
+            }
+
+            // Expectations, which are already saturated (e.g. via ``expect::never``), can never become applicable.
+            if (slot.expectation->is_saturated())
+            {
+                deactivate(index);
+            }
+
+            return Handle{index, slot.generation};
+        }
+
+        void invalidate_cached_matches() noexcept
+        {
+            // New expectations are younger than the cached ones and may thus be preferred.
+            for (auto& lastWinner : m_LastWinners)
+            {
+                lastWinner.store(npos, std::memory_order_relaxed);
+            }
+            m_LastVerified.store(npos, std::memory_order_relaxed);
+        }
+
+        /**
+         * \brief Determines, whether the referenced expectation has already been removed via ``clear``.
+         */
+        [[nodiscard]]
+        bool is_cleared(Handle const& handle) const noexcept
+        {
+            MIMICPP_ASSERT(handle.m_Index < m_Slots.size(), "Expectation does not belong to this storage.");
+
+            // The slot may even have been reused by a different expectation.
+            return handle.m_Generation != m_Slots[handle.m_Index].generation;
+        }
+
+        [[nodiscard]]
+        Slot& owned_slot(Handle const& handle) noexcept
+        {
+            MIMICPP_ASSERT(
+                handle.m_Index < m_Slots.size()
+                    && handle.m_Generation == m_Slots[handle.m_Index].generation
+                    && m_Slots[handle.m_Index].expectation,
+                "Expectation does not belong to this storage.");
+
+            return m_Slots[handle.m_Index];
+        }
+
+        /**
+         * \brief Erases the referenced expectation, without checking it. The storage must be exclusively locked.
+         * \return The erased expectation.
+         */
+        std::shared_ptr<ExpectationT> erase(Handle const& handle) noexcept
+        {
+            Slot& slot = owned_slot(handle);
+            // Retired expectations have already been deactivated.
+            MIMICPP_ASSERT(slot.isActive || slot.expectation->is_saturated(), "Only saturated expectations may be retired.");
+            deactivate(handle.m_Index);
+            unlink<&Slot::all>(m_All, handle.m_Index);
+            // The slot may be reused by a different expectation.
+            if (handle.m_Index == m_LastVerified.load(std::memory_order_relaxed))
+            {
+                m_LastVerified.store(npos, std::memory_order_relaxed);
+            }
+
+            std::shared_ptr<ExpectationT> expectation = std::exchange(slot.expectation, nullptr);
+            ++slot.generation;
+            // The capacity has been reserved during the insertion.
+            m_FreeSlots.emplace_back(handle.m_Index);
+
+            return expectation;
+        }
+
+        [[nodiscard]]
+        static TierT make_tier(std::pmr::memory_resource* const resource)
+        {
+            return [&]<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const) {
+                return TierT{((void)indices, Partition{resource})...};
+            }(std::make_index_sequence<partitionCount>{});
+        }
+
+        [[nodiscard]]
+        static List& acquire_bucket(Partition& partition, std::size_t const key)
+        {
+            if (auto const iter = partition.index.find(key);
+                iter != partition.index.end())
+            {
+                return iter->second;
+            }
+
+            if (partition.spareNode)
+            {
+                partition.spareNode.key() = key;
+                partition.spareNode.mapped() = List{};
+                return partition.index.insert(std::move(partition.spareNode)).position->second;
+            }
+
+            return partition.index[key];
+        }
+
+        [[nodiscard]]
+        static std::optional<std::size_t> lookup_key([[maybe_unused]] ExpectationT const& expectation)
+        {
+            if constexpr (detail::first_arg_indexable<Signature>)
+            {
+                return expectation.index_key();
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+
+        template <Links Slot::* links>
+        void link_back(List& list, std::size_t const index) noexcept
+        {
+            Links& nodeLinks = m_Slots[index].*links;
+            nodeLinks.prev = list.tail;
+            nodeLinks.next = npos;
+            if (npos != list.tail)
+            {
+                (m_Slots[list.tail].*links).next = index;
+            }
+            else
+            {
+                list.head = index;
+            }
+            list.tail = index;
+        }
+
+        template <Links Slot::* links>
+        void unlink(List& list, std::size_t const index) noexcept
+        {
+            Links& nodeLinks = m_Slots[index].*links;
+            if (npos != nodeLinks.prev)
+            {
+                (m_Slots[nodeLinks.prev].*links).next = nodeLinks.next;
+            }
+            else
+            {
+                list.head = nodeLinks.next;
+            }
+
+            if (npos != nodeLinks.next)
+            {
+                (m_Slots[nodeLinks.next].*links).prev = nodeLinks.prev;
+            }
+            else
+            {
+                list.tail = nodeLinks.prev;
+            }
+
+            nodeLinks = Links{};
+        }
+
+        /**
+         * \brief Removes the referenced expectation from the hot path, if it's still active.
+         */
+        void deactivate(std::size_t const index)
+        {
+            Slot& slot = m_Slots[index];
+            if (!slot.isActive)
+            {
+                return;
+            }
+
+            Partition& partition = m_Tiers[slot.isFallback ? 1u : 0u][slot.partition];
+            if (slot.key)
+            {
+                auto const bucketIter = partition.index.find(*slot.key);
+                MIMICPP_ASSERT(bucketIter != partition.index.cend(), "Expectation index out of sync.");
+                unlink<&Slot::hot>(bucketIter->second, index);
+                if (npos == bucketIter->second.head)
+                {
+                    partition.spareNode = partition.index.extract(bucketIter);
+                }
+
+                MIMICPP_ASSERT(0u < m_IndexedCount, "Indexed expectation count out of sync.");
+                --m_IndexedCount;
+            }
+            else
+            {
+                unlink<&Slot::hot>(partition.unindexed, index);
+            }
+
+            slot.isActive = false;
+            if (slot.isSequenced)
+            {
+                MIMICPP_ASSERT(0u < m_SequencedCount, "Sequenced expectation count out of sync.");
+                --m_SequencedCount;
+            }
+
+            if (slot.isQueued)
+            {
+                unlink<&Slot::queue>(m_Queue, index);
+                if (npos == m_Queue.head)
+                {
+                    m_IsQueueOrdered = true;
+                }
+            }
+            else
+            {
+                MIMICPP_ASSERT(0u < m_UnqueuedCount, "Unqueued expectation count out of sync.");
+                --m_UnqueuedCount;
+            }
+        }
+
+        /**
+         * \brief Retires the referenced saturated expectation, thus it's no longer considered on the hot path.
+         * \details The expectation remains in the storage and still contributes to the inapplicable-match diagnostics.
+         * As this requires exclusive access, it's only done once per expectation, directly after it became saturated.
+         */
+        void retire(Handle const handle)
+        {
+            std::unique_lock const lock{m_ExpectationsMx};
+
+            // The expectation may already have been removed concurrently; its slot may even have been reused.
+            if (handle.m_Generation == m_Slots[handle.m_Index].generation)
+            {
+                deactivate(handle.m_Index);
+            }
+        }
+
+        /**
+         * \brief Determines, whether all active expectations form a strictly ordered queue.
+         * \details This is the case, when each of them is attached to the same single sequence, requires an exact
+         * (non-zero) amount of matches and they have been pushed in the order of their sequence-positions.
+         * Each of them is unfulfilled, as it's active, thus it blocks all its successors.
+         */
+        [[nodiscard]]
+        bool is_queue_mode() const noexcept
+        {
+            return 0u == m_UnqueuedCount
+                && npos != m_Queue.head
+                && m_IsQueueOrdered;
+        }
+
+        [[nodiscard]]
+        static constexpr std::size_t qualification_bits(auto const qualification) noexcept
+        {
+            // An empty qualification can never match, but is treated as ``any``; that's always safe.
+            auto const bits = static_cast<std::size_t>(util::to_underlying(qualification));
+            return 0u == bits ? 0b11u : bits;
+        }
+
+        [[nodiscard]]
+        static constexpr std::size_t partition_of(Constness const constness, ValueCategory const category) noexcept
+        {
+            return 3u * (qualification_bits(constness) - 1u) + (qualification_bits(category) - 1u);
+        }
+
+        /**
+         * \brief Invokes the given function for each partition of the tier, whose expectations may accept the given call.
+         */
+        template <typename Fn>
+        static void for_each_compatible_partition(TierT const& tier, CallInfoT const& call, Fn fn)
+        {
+            std::size_t const callConstness = qualification_bits(call.fromConstness);
+            std::size_t const callCategory = qualification_bits(call.fromCategory);
+            for (std::size_t constness{1u}; constness <= 0b11u; ++constness)
+            {
+                if (0u != (constness & callConstness))
+                {
+                    for (std::size_t category{1u}; category <= 0b11u; ++category)
+                    {
+                        if (0u != (category & callCategory))
+                        {
+                            std::invoke(fn, tier[3u * (constness - 1u) + (category - 1u)]);
+                        }
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]]
+        static constexpr std::array<std::atomic<std::size_t>, partitionCount> make_last_winners() noexcept
+        {
+            return []<std::size_t... indices>([[maybe_unused]] std::index_sequence<indices...> const) {
+                return std::array<std::atomic<std::size_t>, partitionCount>{((void)indices, npos)...};
+            }(std::make_index_sequence<partitionCount>{});
+        }
+
+        /**
+         * \brief Determines, whether the expectation of the given slot accepts calls from the overload-qualification of the call.
+         */
+        [[nodiscard]]
+        static bool may_match_qualification(Slot const& slot, CallInfoT const& call) noexcept
+        {
+            std::size_t const constness = slot.partition / 3u + 1u;
+            std::size_t const category = slot.partition % 3u + 1u;
+
+            return 0u != (constness & qualification_bits(call.fromConstness))
+                && 0u != (category & qualification_bits(call.fromCategory));
+        }
+
+        /**
+         * \brief Selects the most recently verified expectation for calls, which are not sampled for the verification.
+         * \return The slot-index of the selected expectation, or ``npos``, if the call must be verified.
+         * \post The state-lock is owned, if a match is returned.
+         */
+        [[nodiscard]]
+        std::size_t find_unverified_match(CallInfoT const& call, StateLock& stateLock)
+        {
+            if (m_VerificationInterval <= 1u
+                || 0u != m_SequencedCount
+                || 0u == m_CallCount.fetch_add(1u, std::memory_order_relaxed) % m_VerificationInterval)
+            {
+                return npos;
+            }
+
+            std::size_t const verified = m_LastVerified.load(std::memory_order_relaxed);
+            if (npos != verified
+                && m_Slots[verified].isActive
+                && may_match_qualification(m_Slots[verified], call)
+                && may_match_key(m_Slots[verified], call))
+            {
+                stateLock.lock();
+                if (m_Slots[verified].expectation->is_applicable())
+                {
+                    return verified;
+                }
+                stateLock.unlock();
+            }
+
+            return npos;
+        }
+
+        /**
+         * \brief Determines, whether the given expectation may match the call, judged by its index-key.
+         */
+        [[nodiscard]]
+        static bool may_match_key([[maybe_unused]] Slot const& slot, [[maybe_unused]] CallInfoT const& call)
+        {
+            if constexpr (detail::first_arg_indexable<Signature>)
+            {
+                return !slot.key
+                    || *slot.key == detail::hash_first_arg<Signature>(call);
+            }
+            else
+            {
+                return true;
+            }
+        }
+
+        /**
+         * \brief Visits all expectations, which may match the given call, in reverse order of construction.
+         * \details Expectations, which don't accept calls from the overload-qualification of the call, and indexed
+         * expectations, whose key differs from the hash of the first call-argument, are skipped, as they are guaranteed
+         * not to match.
+         * The fallback expectations are visited after all regular ones.
+         * The visitation stops, as soon as the visitor returns ``true``.
+         */
+        template <typename Visitor>
+        void visit_candidates(CallInfoT const& call, Visitor visitor) const
+        {
+            [[maybe_unused]] std::optional<std::size_t> hash{};
+            for (TierT const& tier : m_Tiers)
+            {
+                if (visit_tier(tier, call, hash, visitor))
+                {
+                    return;
+                }
+            }
+        }
+
+        template <typename Visitor>
+        [[nodiscard]]
+        bool visit_tier(
+            TierT const& tier,
+            CallInfoT const& call,
+            [[maybe_unused]] std::optional<std::size_t>& hash,
+            Visitor& visitor) const
+        {
+            // Each compatible partition contributes its unindexed expectations and the bucket of the first argument.
+            std::array<std::size_t, 2u * partitionCount> cursors{};
+            std::size_t cursorCount{};
+            for_each_compatible_partition(
+                tier,
+                call,
+                [&](Partition const& partition) {
+                    if (npos != partition.unindexed.tail)
+                    {
+                        cursors[cursorCount++] = partition.unindexed.tail;
+                    }
+
+                    if constexpr (detail::first_arg_indexable<Signature>)
+                    {
+                        if (!partition.index.empty())
+                        {
+                            if (!hash)
+                            {
+                                hash = detail::hash_first_arg<Signature>(call);
+                            }
+
+                            if (auto const iter = partition.index.find(*hash);
+                                iter != partition.index.cend())
+                            {
+                                cursors[cursorCount++] = iter->second.tail;
+                            }
+                        }
+                    }
+                });
+
+            while (0u != cursorCount)
+            {
+                std::size_t youngest{0u};
+                for (std::size_t i{1u}; i < cursorCount; ++i)
+                {
+                    if (m_Slots[cursors[youngest]].id < m_Slots[cursors[i]].id)
+                    {
+                        youngest = i;
+                    }
+                }
+
+                std::size_t const index = cursors[youngest];
+                if (std::size_t const prev = m_Slots[index].hot.prev;
+                    npos != prev)
+                {
+                    cursors[youngest] = prev;
+                }
+                else
+                {
+                    cursors[youngest] = cursors[--cursorCount];
+                }
+
+                if (visitor(index, *m_Slots[index].expectation))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * \brief Selects the best applicable match, without any intermediate storage.
+         * \return The slot-index of the best match, or ``npos``.
+         * \details This is equivalent to collecting all applicable matches (in reverse order of construction) and
+         * reducing them afterward, but the reduction is done in-place.
+         *
+         * As the sequence-rating of a candidate without any sequences can never be beaten by an older candidate,
+         * the scan stops as soon as such a candidate becomes the best match.
+         * When no expectation of this collection is attached to any sequence, this means, that the youngest applicable
+         * match is selected immediately.
+         *
+         * In that case, optimistic calls evaluate the requirements without holding the state-lock; it's only acquired
+         * to check the applicability of an actual match. If that match turns out to be inapplicable (e.g. because a concurrent
+         * call saturated it in the meantime), the lock is released again and the scan continues.
+         * Sequences may be shared between multiple expectations, thus the state-lock is held during the whole scan,
+         * when at least one sequenced expectation exists.
+         *
+         * # Queue mode
+         * When all active expectations form a strictly ordered queue (see ``is_queue_mode``), only the head is
+         * queried. If it doesn't match or is inapplicable (e.g. because a concurrent call saturated it, but didn't retire
+         * it yet), the general scan is performed.
+         *
+         * # Inline cache
+         * Without any sequences, the applicability of an expectation can only change when it's consumed. Once it has
+         * been observed as inapplicable, it therefore remains inapplicable (until it's removed).
+         * When all candidates, which have been visited before the selected one, turned out to be inapplicable, the
+         * selected one is thus the best match for each future call it matches, as long as no younger expectation gets
+         * pushed. It's then remembered as the last winner and tried first by the next call.
+         * The last winner is only remembered, when the set of candidates is fully determined by itself (i.e. it's either
+         * indexed or there are no indexed expectations at all), and it's ignored when the call can not match its key.
+         * Calls with different overload-qualifications visit different partitions, thus each qualification has its
+         * own last winner.
+         *
+         * # Parallel evaluation
+         * When the amount of candidates reaches ``settings::parallel_evaluation_threshold``, their requirements are
+         * evaluated ahead of time by multiple threads (see ``precompute_match_outcomes``). The scan itself stays as-is and
+         * just consumes these outcomes, thus the selection (and the reporting of thrown exceptions) is exactly the same.
+         * \post The state-lock is owned, if a match is returned.
+         */
+        [[nodiscard]]
+        std::size_t find_best_match(
+            reporting::TargetReport const& target,
+            CallInfoT const& call,
+            StateLock& stateLock)
+        {
+            std::size_t best{npos};
+            if (0u == m_SequencedCount)
+            {
+                std::atomic<std::size_t>& lastWinnerCache = m_LastWinners[partition_of(call.fromConstness, call.fromCategory)];
+                std::size_t const lastWinner = lastWinnerCache.load(std::memory_order_relaxed);
+                std::size_t skipped{npos};
+                if (npos != lastWinner
+                    && m_Slots[lastWinner].isActive
+                    && may_match_key(m_Slots[lastWinner], call))
+                {
+                    ExpectationT const& exp = *m_Slots[lastWinner].expectation;
+                    if (detail::determine_is_matching(target, call, exp))
+                    {
+                        stateLock.lock();
+                        if (exp.is_applicable())
+                        {
+                            return lastWinner;
+                        }
+                        stateLock.unlock();
+                    }
+
+                    // It has already been evaluated, thus it's not necessary to do that again.
+                    skipped = lastWinner;
+                }
+
+                bool isProvenBest{npos == skipped};
+                OutcomeBufferLease outcomeBuffer{*this};
+                std::span const outcomes = precompute_match_outcomes(call, true, outcomeBuffer);
+                visit_candidates(
+                    call,
+                    [&](std::size_t const index, ExpectationT const& exp) {
+                        if (index == skipped)
+                        {
+                            return false;
+                        }
+
+                        if (std::ranges::empty(outcomes)
+                                ? detail::determine_is_matching(target, call, exp)
+                                : outcomes[index].resolve(target, call, exp))
+                        {
+                            stateLock.lock();
+                            if (exp.is_applicable())
+                            {
+                                best = index;
+                                return true;
+                            }
+                            stateLock.unlock();
+                        }
+                        else
+                        {
+                            isProvenBest = false;
+                        }
+
+                        return false;
+                    });
+
+                if (npos != best
+                    && isProvenBest
+                    && (m_Slots[best].key || 0u == m_IndexedCount))
+                {
+                    lastWinnerCache.store(best, std::memory_order_relaxed);
+                }
+
+                return best;
+            }
+
+            if (is_queue_mode())
+            {
+                // All other expectations are blocked by the head, thus it's the only possible match.
+                std::size_t const head = m_Queue.head;
+                ExpectationT const& exp = *m_Slots[head].expectation;
+                if (may_match_key(m_Slots[head], call)
+                    && detail::determine_is_matching(target, call, exp))
+                {
+                    stateLock.lock();
+                    if (exp.is_applicable())
+                    {
+                        return head;
+                    }
+                }
+            }
+
+            OutcomeBufferLease outcomeBuffer{*this};
+            std::span const outcomes = precompute_match_outcomes(call, false, outcomeBuffer);
+            if (!stateLock.owns_lock())
+            {
+                stateLock.lock();
+            }
+            detail::SequenceRatingBuffer bestRatings{};
+            detail::SequenceRatingBuffer candidateRatings{};
+            visit_candidates(
+                call,
+                [&](std::size_t const index, ExpectationT const& exp) {
+                    // Fallbacks are only considered, when no regular expectation is applicable.
+                    if (npos != best
+                        && m_Slots[index].isFallback)
+                    {
+                        return true;
+                    }
+
+                    if ((std::ranges::empty(outcomes)
+                             ? detail::determine_is_matching(target, call, exp)
+                             : outcomes[index].resolve(target, call, exp))
+                        && exp.is_applicable())
+                    {
+                        candidateRatings.assign(exp);
+                        if (npos == best
+                            || !sequence::detail::has_better_rating(bestRatings.view(), candidateRatings.view()))
+                        {
+                            best = index;
+                            std::ranges::swap(bestRatings, candidateRatings);
+                        }
+
+                        return std::ranges::empty(bestRatings.view());
+                    }
+
+                    return false;
+                });
+
+            if (npos == best)
+            {
+                stateLock.unlock();
+            }
+
+            return best;
+        }
+
+        /**
+         * \brief Determines the amount of threads, which shall participate in the evaluation of the given amount of expectations.
+         */
+        [[nodiscard]]
+        std::size_t parallel_workers_for(std::size_t const count) const noexcept
+        {
+            if (m_StateMx.is_confined()
+                || count < settings::parallel_evaluation_threshold())
+            {
+                return 1u;
+            }
 
-            if (!expectation->is_satisfied())
+            std::size_t workers = settings::parallel_evaluation_workers();
+            if (0u == workers)
             {
-                reporting::detail::report_unfulfilled_expectation(
-                    expectation->report());
+                workers = std::thread::hardware_concurrency();
             }
+
+            return std::max<std::size_t>(1u, workers);
         }
 
         /**
-         * \brief Handles the incoming call.
-         * \param target The mock-target, which received the call.
-         * \param call The call to be handled.
-         * \return Returns an appropriate result from the matched expectation.
-         * \details This function queries all stored expectations, whether they accept the call.
-         * If multiple matches are possible, the best match is selected and a "matched"-report is emitted.
-         * If no matches are found, "no matched"-report is emitted and the call is aborted (e.g. by throwing an exception or terminating).
-         * If matches are possible, but all expectations are saturated, an "inapplicable match"-report is emitted.
+         * \brief Evaluates the requirements of all candidates ahead of time, if there are enough of them.
+         * \return The outcomes (indexed by slot), or an empty span, when the candidates shall be evaluated sequentially.
+         * \details When ``stopAtFirstMatch`` is set, candidates, which are visited after an already found match, are skipped.
+         * Such candidates are evaluated on demand, if the match turns out to be inapplicable.
+         * The outcomes are stored in the leased buffer, thus they are valid as long as the lease.
          */
         [[nodiscard]]
-        ReturnT handle_call(reporting::TargetReport target, CallInfoT call)
+        std::span<detail::MatchOutcome const> precompute_match_outcomes(
+            CallInfoT const& call,
+            bool const stopAtFirstMatch,
+            OutcomeBufferLease& lease) const
         {
-            std::vector<ExpectationT*> matches{};
-            std::vector<ExpectationT*> inapplicableMatches{};
-            std::vector<std::tuple<ExpectationT*, reporting::RequirementOutcomes>> noMatches{};
-
-            std::scoped_lock const lock{m_ExpectationsMx};
-            evaluate_expectations(target, call, matches, inapplicableMatches, noMatches);
-
-            std::size_t const stacktraceSkip{1u + call.baseStacktraceSkip};
-            if (!std::ranges::empty(matches))
+            // The candidates are a subset of the stored expectations, thus most calls can be rejected early.
+            if (1u == parallel_workers_for(m_Slots.size() - m_FreeSlots.size()))
             {
-                std::vector reports = detail::gather_expectation_reports(matches);
-                MIMICPP_ASSERT(matches.size() == reports.size(), "Size mismatch.");
-                auto const bestIndex = detail::find_best_match(reports);
-                MIMICPP_ASSERT(0 <= bestIndex && bestIndex < std::ssize(reports), "Invalid index.");
-
-                auto& expectation = *matches[bestIndex];
-
-                if (settings::report_success())
-                {
-                    auto& report = reports[bestIndex];
-
-                    // Todo: Avoid the call copy
-                    // Maybe we can prevent the copy here, but we should keep the instruction order as-is, because
-                    // in cases of a throwing finalizer, we might introduce bugs. At least there are some tests, which
-                    // will fail if done wrong.
-                    reporting::detail::report_full_match(
-                        reporting::make_call_report(std::move(target), call, util::stacktrace::current(stacktraceSkip)),
-                        std::move(report));
-                }
-
-                expectation.consume(call);
-                return expectation.finalize_call(call);
+                return {};
             }
 
-            if (!std::ranges::empty(inapplicableMatches))
+            OutcomeBuffer& buffer = lease.acquire();
+            std::pmr::vector<std::size_t>& candidates = buffer.candidates;
+            visit_candidates(
+                call,
+                [&](std::size_t const index, [[maybe_unused]] ExpectationT const& exp) {
+                    candidates.emplace_back(index);
+                    return false;
+                });
+            std::size_t const workers = parallel_workers_for(candidates.size());
+            if (1u == workers)
             {
-                reporting::detail::report_inapplicable_matches(
-                    reporting::make_call_report(std::move(target), std::move(call), util::stacktrace::current(stacktraceSkip)),
-                    detail::gather_expectation_reports(inapplicableMatches));
+                return {};
             }
 
-            reporting::detail::report_no_matches(
-                reporting::make_call_report(std::move(target), std::move(call), util::stacktrace::current(stacktraceSkip)),
-                detail::make_no_match_reports(std::move(noMatches)));
-        }
+            std::pmr::vector<detail::MatchOutcome>& outcomes = buffer.outcomes;
+            outcomes.resize(m_Slots.size());
+            std::atomic_size_t firstMatch{npos};
+            util::detail::parallel_for(
+                candidates.size(),
+                workers,
+                [&](std::size_t const position) {
+                    if (stopAtFirstMatch
+                        && firstMatch.load(std::memory_order_relaxed) < position)
+                    {
+                        return;
+                    }
 
-    private:
-        std::vector<std::shared_ptr<ExpectationT>> m_Expectations{};
-        std::mutex m_ExpectationsMx{};
+                    std::size_t const index = candidates[position];
+                    detail::MatchOutcome& outcome = outcomes[index];
+                    outcome.evaluate(call, *m_Slots[index].expectation);
+                    if (stopAtFirstMatch && outcome.is_matching())
+                    {
+                        std::size_t current = firstMatch.load(std::memory_order_relaxed);
+                        while (position < current
+                               && !firstMatch.compare_exchange_weak(current, position, std::memory_order_relaxed))
+                        {
+                        }
+                    }
+                });
+
+            return outcomes;
+        }
 
         void evaluate_expectations(
-            reporting::TargetReport const& target,
             CallInfoT const& call,
-            std::vector<ExpectationT*>& matches,
             std::vector<ExpectationT*>& inapplicableMatches,
             std::vector<std::tuple<ExpectationT*, reporting::RequirementOutcomes>>& noMatches)
         {
-            for (auto const& exp : std::views::reverse(m_Expectations))
+            std::vector<ExpectationT*> expectations{};
+            for (std::size_t index{m_All.tail}; npos != index; index = m_Slots[index].all.prev)
+            {
+                expectations.emplace_back(m_Slots[index].expectation.get());
+            }
+
+            std::vector<std::optional<reporting::RequirementOutcomes>> requirementOutcomes(expectations.size());
+            util::detail::parallel_for(
+                expectations.size(),
+                parallel_workers_for(expectations.size()),
+                [&](std::size_t const i) {
+                    requirementOutcomes[i] = detail::determine_requirement_outcomes(call, *expectations[i]);
+                });
+
+            for (std::size_t i{0u}; i < expectations.size(); ++i)
             {
-                if (std::optional outcomes = detail::determine_requirement_outcomes(target, call, *exp))
+                ExpectationT* const exp = expectations[i];
+                if (std::optional outcomes = std::move(requirementOutcomes[i]))
                 {
                     if (std::ranges::any_of(outcomes->outcomes, [](auto const& el) { return el == false; }))
                     {
-                        noMatches.emplace_back(exp.get(), *std::move(outcomes));
+                        noMatches.emplace_back(exp, *std::move(outcomes));
                     }
                     else if (!exp->is_applicable())
                     {
-                        inapplicableMatches.emplace_back(exp.get());
-                    }
-                    else
-                    {
-                        matches.emplace_back(exp.get());
+                        inapplicableMatches.emplace_back(exp);
                     }
                 }
             }
@@ -564,8 +2285,16 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         [[nodiscard]]
         constexpr bool is_applicable() const noexcept override
         {
-            return std::holds_alternative<reporting::state_applicable>(
-                m_ControlPolicy.state());
+            return detail::query_is_applicable(m_ControlPolicy);
+        }
+
+        /**
+         * \copydoc Expectation::is_saturated
+         */
+        [[nodiscard]]
+        constexpr bool is_saturated() const noexcept override
+        {
+            return detail::query_is_saturated(m_ControlPolicy);
         }
 
         /**
@@ -575,7 +2304,98 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         reporting::RequirementOutcomes matches(const CallInfoT& call) const override
         {
             return reporting::RequirementOutcomes{
-                .outcomes = gather_requirement_outcomes(call)};
+                .outcomes = detail::to_outcome_vector(gather_requirement_outcomes(call))};
+        }
+
+        /**
+         * \copydoc Expectation::is_matching
+         */
+        [[nodiscard]]
+        bool is_matching(const CallInfoT& call) const override
+        {
+            // Stops at the first failing policy.
+            // The individual outcomes are only required for the diagnostics and thus gathered lazily via `matches`.
+            return std::apply(
+                [&](auto const&... policies) {
+                    return (true && ... && static_cast<bool>(policies.matches(call)));
+                },
+                m_Policies);
+        }
+
+        /**
+         * \copydoc Expectation::sequence_count
+         */
+        [[nodiscard]]
+        constexpr std::size_t sequence_count() const noexcept override
+        {
+            return detail::query_sequence_count(m_ControlPolicy);
+        }
+
+        /**
+         * \copydoc Expectation::sequence_ratings
+         */
+        [[nodiscard]]
+        std::size_t sequence_ratings(std::span<sequence::rating> const buffer) const override
+        {
+            return detail::query_sequence_ratings(m_ControlPolicy, buffer);
+        }
+
+        /**
+         * \copydoc Expectation::strict_sequence_position
+         */
+        [[nodiscard]]
+        constexpr std::optional<sequence::position> strict_sequence_position() const noexcept override
+        {
+            return detail::query_strict_sequence_position(m_ControlPolicy);
+        }
+
+        /**
+         * \copydoc Expectation::index_key
+         */
+        [[nodiscard]]
+        constexpr std::optional<std::size_t> index_key() const override
+        {
+            // The first policy, which is able to provide a key, wins.
+            std::optional<std::size_t> key{};
+            std::apply(
+                [&](auto const&... policies) {
+                    (void)(... || (key = detail::query_index_key<Signature>(policies)).has_value());
+                },
+                m_Policies);
+
+            return key;
+        }
+
+        /**
+         * \copydoc Expectation::qualification
+         */
+        [[nodiscard]]
+        constexpr std::tuple<Constness, ValueCategory> qualification() const noexcept override
+        {
+            // Each policy may narrow the accepted qualifications.
+            auto constness = util::to_underlying(Constness::any);
+            auto category = util::to_underlying(ValueCategory::any);
+            std::apply(
+                [&](auto const&... policies) noexcept {
+                    (..., (constness &= util::to_underlying(detail::query_constness(policies))));
+                    (..., (category &= util::to_underlying(detail::query_value_category(policies))));
+                },
+                m_Policies);
+
+            return {Constness{constness}, ValueCategory{category}};
+        }
+
+        /**
+         * \copydoc Expectation::is_fallback
+         */
+        [[nodiscard]]
+        constexpr bool is_fallback() const noexcept override
+        {
+            return std::apply(
+                [](auto const&... policies) noexcept {
+                    return (false || ... || detail::query_is_fallback(policies));
+                },
+                m_Policies);
         }
 
         /**
@@ -615,7 +2435,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         [[nodiscard]]
         constexpr StringT const& mock_name() const noexcept override
         {
-            return m_Target.name;
+            return m_Target.name();
         }
 
     private:
@@ -626,13 +2446,17 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         [[no_unique_address]] FinalizerT m_Finalizer{};
 
         [[nodiscard]]
-        std::vector<bool> gather_requirement_outcomes(CallInfoT const& call) const
+        std::bitset<sizeof...(Policies)> gather_requirement_outcomes(CallInfoT const& call) const
         {
-            return std::apply(
+            std::bitset<sizeof...(Policies)> outcomes{};
+            std::apply(
                 [&](auto const&... policies) {
-                    return std::vector<bool>{policies.matches(call)...};
+                    [[maybe_unused]] std::size_t index{};
+                    (..., outcomes.set(index++, static_cast<bool>(policies.matches(call))));
                 },
                 m_Policies);
+
+            return outcomes;
         }
     };
 
@@ -666,6 +2490,13 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
             [[nodiscard]]
             virtual StringT const& mock_name() const noexcept = 0;
 
+            /**
+             * \brief Move-constructs the model into the given storage.
+             * \details The moved-from model does no longer own the expectation.
+             */
+            [[nodiscard]]
+            virtual Concept* move_into(std::byte* storage) noexcept = 0;
+
         protected:
             Concept() = default;
         };
@@ -680,7 +2511,11 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
 
             ~Model() noexcept(false) override
             {
-                m_Storage->remove(m_Expectation);
+                // moved-from models don't own the expectation anymore
+                if (m_Storage)
+                {
+                    m_Storage->remove(m_Handle);
+                }
             }
 
             [[nodiscard]]
@@ -693,7 +2528,24 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
                 MIMICPP_ASSERT(m_Storage, "Storage is nullptr.");
                 MIMICPP_ASSERT(m_Expectation, "Expectation is nullptr.");
 
-                m_Storage->push(m_Expectation);
+                m_Handle = m_Storage->push(m_Expectation);
+            }
+
+            [[nodiscard]]
+            Model(Model&& other) noexcept
+                : Concept{},
+                  m_Storage{std::move(other.m_Storage)},
+                  m_Expectation{std::move(other.m_Expectation)},
+                  m_Handle{other.m_Handle}
+            {
+            }
+
+            Model& operator=(Model&&) = delete;
+
+            [[nodiscard]]
+            Concept* move_into(std::byte* storage) noexcept override
+            {
+                return ::new (storage) Model{std::move(*this)};
             }
 
             [[nodiscard]]
@@ -723,6 +2575,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         private:
             std::shared_ptr<StorageT> m_Storage;
             std::shared_ptr<ExpectationT> m_Expectation;
+            typename StorageT::Handle m_Handle{};
         };
 
     public:
@@ -732,8 +2585,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
          */
         ~ScopedExpectation() noexcept(false)
         {
-            // we must call the dtor manually here, because std::unique_ptr's dtor mustn't throw.
-            delete m_Inner.release(); // NOLINT(*-uniqueptr-delete-release)
+            reset();
         }
 
         /**
@@ -747,11 +2599,14 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         explicit ScopedExpectation(
             std::shared_ptr<ExpectationCollection<Signature>> collection,
             std::shared_ptr<typename ExpectationCollection<Signature>::ExpectationT> expectation) noexcept
-            : m_Inner{
-                  std::make_unique<Model<Signature>>(
-                      std::move(collection),
-                      std::move(expectation))}
         {
+            static_assert(
+                sizeof(Model<Signature>) <= sizeof(m_ModelStorage) && alignof(Model<Signature>) <= alignof(ModelStorageT),
+                "The model does not fit into the inline storage.");
+
+            m_Inner = ::new (m_ModelStorage) Model<Signature>{
+                std::move(collection),
+                std::move(expectation)};
         }
 
         /**
@@ -781,15 +2636,36 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         ScopedExpectation& operator=(ScopedExpectation const&) = delete;
 
         /**
-         * \brief Defaulted move-constructor.
+         * \brief Move-constructor.
          */
         [[nodiscard]]
-        ScopedExpectation(ScopedExpectation&&) = default;
+        ScopedExpectation(ScopedExpectation&& other) noexcept
+        {
+            if (other.m_Inner)
+            {
+                m_Inner = other.m_Inner->move_into(m_ModelStorage);
+                other.reset();
+            }
+        }
 
         /**
-         * \brief Defaulted move-assignment-operator.
+         * \brief Move-assignment-operator.
+         * \details The currently owned expectation is removed first, which may report it as unfulfilled.
          */
-        ScopedExpectation& operator=(ScopedExpectation&&) = default;
+        ScopedExpectation& operator=(ScopedExpectation&& other) noexcept(false)
+        {
+            if (this != &other)
+            {
+                reset();
+                if (other.m_Inner)
+                {
+                    m_Inner = other.m_Inner->move_into(m_ModelStorage);
+                    other.reset();
+                }
+            }
+
+            return *this;
+        }
 
         /**
          * \brief Queries the stored expectation, whether it's satisfied.
@@ -832,7 +2708,237 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         }
 
     private:
-        std::unique_ptr<Concept> m_Inner;
+        // The model has the same layout for each signature, thus no allocation is required.
+        using ModelStorageT = Model<void()>;
+        alignas(ModelStorageT) std::byte m_ModelStorage[sizeof(ModelStorageT)];
+        Concept* m_Inner{};
+
+        void reset()
+        {
+            if (Concept* const inner = std::exchange(m_Inner, nullptr))
+            {
+                inner->~Concept();
+            }
+        }
+    };
+
+    /**
+     * \brief Takes exclusive ownership of multiple expectations, which are created from a range of rows.
+     * \ingroup EXPECTATION
+     * \details This is intended for table-driven tests, which set up lots of similar expectations.
+     * Instead of constructing a ``ScopedExpectation`` for each row, the batch creates an expectation for each row of the
+     * given range and inserts all of them at once into the expectation-collection. Thus, the collection is locked and
+     * its internal storage is reserved just once.
+     * Accordingly, all expectations are removed at once, when the batch is destroyed; the unsatisfied ones are then
+     * reported in row-order.
+     *
+     * ```cpp
+     * ScopedExpectationBatch const expectations{
+     *     rows,
+     *     [&](Row const& row) { return mock.expect_call(row.arg) and finally::returns(row.result); }};
+     * ```
+     *
+     * \attention All expectations of a batch must target the same overload of the same mock.
+     */
+    class ScopedExpectationBatch
+    {
+    private:
+        class Concept
+        {
+        public:
+            virtual ~Concept() = default;
+
+            Concept(const Concept&) = delete;
+            Concept& operator=(const Concept&) = delete;
+            Concept(Concept&&) = delete;
+            Concept& operator=(Concept&&) = delete;
+
+            // Removes the expectations from the storage, which may report them as unfulfilled.
+            virtual void remove() = 0;
+            [[nodiscard]]
+            virtual std::size_t size() const noexcept = 0;
+            [[nodiscard]]
+            virtual bool is_satisfied() const = 0;
+
+        protected:
+            Concept() = default;
+        };
+
+        template <typename Storage>
+        class Model final
+            : public Concept
+        {
+        public:
+            using StorageT = Storage;
+            using ExpectationT = typename StorageT::ExpectationT;
+
+            [[nodiscard]]
+            explicit Model(
+                std::shared_ptr<StorageT>&& storage,
+                std::pmr::vector<std::shared_ptr<ExpectationT>>&& expectations)
+                : m_Storage{std::move(storage)},
+                  m_Expectations{std::move(expectations)},
+                  m_Handles{m_Storage->push(m_Expectations)}
+            {
+            }
+
+            void remove() override
+            {
+                m_Storage->remove(m_Handles);
+            }
+
+            [[nodiscard]]
+            std::size_t size() const noexcept override
+            {
+                return m_Expectations.size();
+            }
+
+            [[nodiscard]]
+            bool is_satisfied() const override
+            {
+                return std::ranges::all_of(
+                    m_Expectations,
+                    [](auto const& expectation) { return expectation->is_satisfied(); });
+            }
+
+        private:
+            std::shared_ptr<StorageT> m_Storage;
+            std::pmr::vector<std::shared_ptr<ExpectationT>> m_Expectations;
+            std::pmr::vector<typename StorageT::Handle> m_Handles;
+        };
+
+    public:
+        /**
+         * \brief Removes all owned expectations from the ExpectationCollection and checks, whether they are satisfied.
+         * \throws In cases of unsatisfied expectations, the destructor is expected to throw or terminate otherwise.
+         */
+        ~ScopedExpectationBatch() noexcept(false)
+        {
+            reset();
+        }
+
+        /**
+         * \brief Creates an expectation for each row and inserts all of them at once.
+         * \tparam Rows The range type.
+         * \tparam Factory The factory type.
+         * \param rows The rows, from which the expectations are created.
+         * \param factory Invocable, which creates an expectation (e.g. an ExpectationBuilder) from a single row.
+         * \param loc The source-location, which is shared by all created expectations.
+         * \throws std::invalid_argument When the created expectations target different mocks.
+         * \details All internal storage of the batch is allocated from the ``memory_resource`` of the targeted mock.
+         */
+        template <std::ranges::input_range Rows, typename Factory>
+            requires std::invocable<Factory&, std::ranges::range_reference_t<Rows>>
+                      && requires(std::invoke_result_t<Factory&, std::ranges::range_reference_t<Rows>> builder, util::SourceLocation loc) {
+                             std::move(builder).release(loc);
+                         }
+        [[nodiscard]]
+        explicit ScopedExpectationBatch(Rows&& rows, Factory factory, util::SourceLocation loc = {})
+        {
+            using BuilderT = std::invoke_result_t<Factory&, std::ranges::range_reference_t<Rows>>;
+            using StorageT = typename std::remove_cvref_t<BuilderT>::StorageT;
+            using ModelT = Model<StorageT>;
+
+            std::size_t reservedCount{};
+            if constexpr (std::ranges::sized_range<Rows>)
+            {
+                reservedCount = std::ranges::size(rows);
+            }
+
+            auto iter = std::ranges::begin(rows);
+            auto const end = std::ranges::end(rows);
+            if (iter == end)
+            {
+                return;
+            }
+
+            // The targeted storage (and thus the memory-resource) is just known after the first row has been released.
+            auto [storage, first] = std::invoke(factory, *iter).release(loc);
+            std::pmr::memory_resource* const resource = storage->memory_resource();
+            std::pmr::vector<std::shared_ptr<typename StorageT::ExpectationT>> expectations{resource};
+            expectations.reserve(reservedCount);
+            expectations.emplace_back(std::move(first));
+
+            for (++iter; iter != end; ++iter)
+            {
+                auto [rowStorage, expectation] = std::invoke(factory, *iter).release(loc);
+                if (storage != rowStorage)
+                {
+                    throw std::invalid_argument{"All expectations of a batch must target the same mock."};
+                }
+
+                expectations.emplace_back(std::move(expectation));
+            }
+
+            m_Inner = std::allocate_shared<ModelT>(
+                std::pmr::polymorphic_allocator<ModelT>{resource},
+                std::move(storage),
+                std::move(expectations));
+        }
+
+        /**
+         * \brief Deleted copy-constructor.
+         */
+        ScopedExpectationBatch(ScopedExpectationBatch const&) = delete;
+
+        /**
+         * \brief Deleted copy-assignment-operator.
+         */
+        ScopedExpectationBatch& operator=(ScopedExpectationBatch const&) = delete;
+
+        /**
+         * \brief Defaulted move-constructor.
+         */
+        [[nodiscard]]
+        ScopedExpectationBatch(ScopedExpectationBatch&&) = default;
+
+        /**
+         * \brief Move-assignment-operator.
+         * \details The currently owned expectations are removed first, which may report them as unfulfilled.
+         */
+        ScopedExpectationBatch& operator=(ScopedExpectationBatch&& other) noexcept(false)
+        {
+            if (this != &other)
+            {
+                reset();
+                m_Inner = std::move(other.m_Inner);
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Queries the amount of owned expectations.
+         * \return The amount of expectations.
+         */
+        [[nodiscard]]
+        std::size_t size() const noexcept
+        {
+            return m_Inner ? m_Inner->size() : 0u;
+        }
+
+        /**
+         * \brief Queries all owned expectations, whether they are satisfied.
+         * \return True, if all are satisfied.
+         */
+        [[nodiscard]]
+        bool is_satisfied() const
+        {
+            return !m_Inner || m_Inner->is_satisfied();
+        }
+
+    private:
+        // The batch is the single owner; the model is just shared to support allocators.
+        std::shared_ptr<Concept> m_Inner{};
+
+        void reset()
+        {
+            // The model itself is destroyed in any case, even if the removal reports via an exception.
+            if (std::shared_ptr<Concept> const inner = std::move(m_Inner))
+            {
+                inner->remove();
+            }
+        }
     };
 
     /**
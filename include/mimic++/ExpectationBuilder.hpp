@@ -27,6 +27,7 @@
 #ifndef MIMICPP_DETAIL_IS_MODULE
     #include <concepts>
     #include <memory>
+    #include <memory_resource>
     #include <tuple>
     #include <utility>
 #endif
@@ -178,35 +179,53 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
 
         [[nodiscard]]
         ScopedExpectation finalize(util::SourceLocation sourceLocation) &&
+        {
+            auto [storage, expectation] = std::move(*this).release(std::move(sourceLocation));
+
+            return ScopedExpectation{
+                std::move(storage),
+                std::move(expectation)};
+        }
+
+        /**
+         * \brief Creates the expectation, but doesn't insert it into the storage.
+         * \param sourceLocation The source-location of the expectation.
+         * \return The target storage and the created expectation.
+         * \details This is used, when multiple expectations shall be inserted at once (e.g. by ``ScopedExpectationBatch``).
+         */
+        [[nodiscard]]
+        std::tuple<std::shared_ptr<StorageT>, std::shared_ptr<Expectation<Signature>>> release(util::SourceLocation sourceLocation) &&
         {
             static_assert(
                 finalize_policy_for<FinalizePolicy, Signature>,
                 "For non-void return types, a finalize-policy must be specified. "
                 "See: https://dnkpp.github.io/mimicpp/db/d7a/group___e_x_p_e_c_t_a_t_i_o_n___f_i_n_a_l_i_z_e_r.html#details");
 
-            return ScopedExpectation{
-                std::move(m_Storage),
-                std::apply(
-                    [&](auto&... policies) {
-                        ControlPolicy controlPolicy{
-                            sourceLocation,
-                            std::move(m_TimesConfig),
-                            std::move(m_SequenceConfig)};
-
-                        using Expectation = BasicExpectation<
-                            Signature,
-                            decltype(controlPolicy),
-                            FinalizePolicy,
-                            Policies...>;
-
-                        return std::make_unique<Expectation>(
-                            std::move(sourceLocation),
-                            std::move(m_TargetReport),
-                            std::move(controlPolicy),
-                            std::move(m_FinalizePolicy),
-                            std::move(policies)...);
-                    },
-                    m_ExpectationPolicies)};
+            std::shared_ptr<Expectation<Signature>> expectation = std::apply(
+                [&](auto&... policies) {
+                    ControlPolicy controlPolicy{
+                        sourceLocation,
+                        std::move(m_TimesConfig),
+                        std::move(m_SequenceConfig)};
+
+                    using Expectation = BasicExpectation<
+                        Signature,
+                        decltype(controlPolicy),
+                        FinalizePolicy,
+                        Policies...>;
+
+                    // Allocates the expectation and its control-block at once.
+                    return std::allocate_shared<Expectation>(
+                        std::pmr::polymorphic_allocator<Expectation>{m_Storage->memory_resource()},
+                        std::move(sourceLocation),
+                        std::move(m_TargetReport),
+                        std::move(controlPolicy),
+                        std::move(m_FinalizePolicy),
+                        std::move(policies)...);
+                },
+                m_ExpectationPolicies);
+
+            return {std::move(m_Storage), std::move(expectation)};
         }
 
     private:
@@ -0,0 +1,461 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_EXPECTATION_FEED_HPP
+#define MIMICPP_EXPECTATION_FEED_HPP
+
+#pragma once
+
+#include "mimic++/Call.hpp"
+#include "mimic++/Expectation.hpp"
+#include "mimic++/Fwd.hpp"
+#include "mimic++/TypeTraits.hpp"
+#include "mimic++/config/Config.hpp"
+#include "mimic++/config/Settings.hpp"
+#include "mimic++/reporting/ExpectationReport.hpp"
+#include "mimic++/utilities/AffineMutex.hpp"
+#include "mimic++/utilities/SourceLocation.hpp"
+
+#ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <concepts>
+    #include <cstddef>
+    #include <functional>
+    #include <memory>
+    #include <memory_resource>
+    #include <mutex>
+    #include <optional>
+    #include <ranges>
+    #include <span>
+    #include <stdexcept>
+    #include <tuple>
+    #include <type_traits>
+    #include <utility>
+#endif
+
+namespace mimicpp::detail
+{
+    template <typename Rows, typename Factory>
+    using feed_builder_t = std::invoke_result_t<Factory&, std::ranges::range_reference_t<Rows>>;
+
+    template <typename Rows, typename Factory>
+    concept feed_factory_for = std::ranges::input_range<Rows>
+                            && std::invocable<Factory&, std::ranges::range_reference_t<Rows>>
+                            && requires(feed_builder_t<Rows, Factory> builder, util::SourceLocation loc) {
+                                   std::move(builder).release(loc);
+                               };
+
+    /**
+     * \brief Owns the rows and the factory, and tracks the next row to be materialized.
+     * \details The targeted mock (and thus its memory-resource) is just known, after the first row has been
+     * materialized. This state is therefore allocated separately from the feed, as it must not be moved afterward;
+     * the iterator (and the materialized rows) may refer to it.
+     */
+    template <std::ranges::view Rows, typename Factory>
+    class FeedCursor
+    {
+    public:
+        [[nodiscard]]
+        explicit FeedCursor(Rows rows, Factory factory)
+            : m_Rows{std::move(rows)},
+              m_Factory{std::move(factory)},
+              m_Iter{std::ranges::begin(m_Rows)}
+        {
+        }
+
+        FeedCursor(FeedCursor const&) = delete;
+        FeedCursor& operator=(FeedCursor const&) = delete;
+        FeedCursor(FeedCursor&&) = delete;
+        FeedCursor& operator=(FeedCursor&&) = delete;
+
+        [[nodiscard]]
+        bool is_exhausted() const noexcept
+        {
+            return m_Iter == std::ranges::end(m_Rows);
+        }
+
+        [[nodiscard]]
+        auto pull(util::SourceLocation const& from)
+        {
+            MIMICPP_ASSERT(!is_exhausted(), "No rows left.");
+
+            auto result = std::invoke(m_Factory, *m_Iter).release(from);
+            ++m_Iter;
+
+            return result;
+        }
+
+    private:
+        Rows m_Rows;
+        Factory m_Factory;
+        std::ranges::iterator_t<Rows> m_Iter;
+    };
+
+    /**
+     * \brief An expectation, which pulls its rows one after another from the underlying range.
+     * \details Just the current row is materialized (and the previous one, until its finalization is done).
+     * When the current row becomes saturated, the next one is materialized during the finalization of that call; thus
+     * outside the lock of the collection, which makes it possible for the factory to use the same mock.
+     * If the factory throws, the feed stays at the saturated row and the materialization is retried, when the feed is
+     * evaluated the next time. The feed can not be selected in the meantime.
+     */
+    template <typename Storage, std::ranges::view Rows, typename Factory>
+    class FeedExpectation final
+        : public Storage::ExpectationT
+    {
+    public:
+        using StorageT = Storage;
+        using ExpectationT = typename StorageT::ExpectationT;
+        using CallInfoT = typename ExpectationT::CallInfoT;
+        using ReturnT = typename ExpectationT::ReturnT;
+        using CursorT = FeedCursor<Rows, Factory>;
+
+        [[nodiscard]]
+        explicit FeedExpectation(
+            std::shared_ptr<CursorT> cursor,
+            StorageT const& target,
+            std::shared_ptr<ExpectationT> first,
+            util::SourceLocation from)
+            : m_Cursor{std::move(cursor)},
+              m_From{std::move(from)},
+              m_Target{std::addressof(target)},
+              // These properties are determined by the policy types, thus they are the same for each row.
+              m_SequenceCount{first->sequence_count()},
+              m_Qualification{first->qualification()},
+              m_IsFallback{first->is_fallback()},
+              m_Mx{target.thread_affinity()},
+              m_IsExhausted{m_Cursor->is_exhausted()},
+              m_Current{std::move(first)}
+        {
+        }
+
+        [[nodiscard]]
+        reporting::ExpectationReport report() const override
+        {
+            std::scoped_lock const lock{m_Mx};
+
+            reporting::ExpectationReport report = m_Current->report();
+            report.rowIndex = m_RowIndex;
+
+            return report;
+        }
+
+        [[nodiscard]]
+        bool is_satisfied() const noexcept override
+        {
+            std::scoped_lock const lock{m_Mx};
+
+            return is_exhausted()
+                && m_Current->is_satisfied();
+        }
+
+        [[nodiscard]]
+        bool is_applicable() const noexcept override
+        {
+            std::scoped_lock const lock{m_Mx};
+
+            return !m_IsAdvancePending
+                && m_Current->is_applicable();
+        }
+
+        [[nodiscard]]
+        bool is_saturated() const noexcept override
+        {
+            std::scoped_lock const lock{m_Mx};
+
+            return is_exhausted()
+                && m_Current->is_saturated();
+        }
+
+        [[nodiscard]]
+        reporting::RequirementOutcomes matches(CallInfoT const& call) const override
+        {
+            advance();
+
+            return current()->matches(call);
+        }
+
+        [[nodiscard]]
+        bool is_matching(CallInfoT const& call) const override
+        {
+            // Retries a previously failed materialization.
+            advance();
+
+            std::shared_ptr<ExpectationT> row{};
+            {
+                std::scoped_lock const lock{m_Mx};
+                if (m_IsAdvancePending)
+                {
+                    return false;
+                }
+
+                row = m_Current;
+            }
+
+            return row->is_matching(call);
+        }
+
+        [[nodiscard]]
+        std::size_t sequence_count() const noexcept override
+        {
+            return m_SequenceCount;
+        }
+
+        [[nodiscard]]
+        std::size_t sequence_ratings(std::span<sequence::rating> const buffer) const override
+        {
+            return current()->sequence_ratings(buffer);
+        }
+
+        [[nodiscard]]
+        std::optional<sequence::position> strict_sequence_position() const noexcept override
+        {
+            // Each row has a different position.
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        std::optional<std::size_t> index_key() const override
+        {
+            // Each row may have a different key.
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        std::tuple<Constness, ValueCategory> qualification() const noexcept override
+        {
+            return m_Qualification;
+        }
+
+        [[nodiscard]]
+        bool is_fallback() const noexcept override
+        {
+            return m_IsFallback;
+        }
+
+        void consume(CallInfoT const& call) override
+        {
+            std::scoped_lock const lock{m_Mx};
+
+            MIMICPP_ASSERT(!m_IsAdvancePending, "The saturated row must not be consumed.");
+            m_Current->consume(call);
+            // The consumed row must finalize the call, thus it's kept alive until the next consumption.
+            m_Consumed = m_Current;
+
+            // The collection is still locked, thus the next row is materialized afterward.
+            m_IsAdvancePending = m_Current->is_saturated()
+                              && !m_IsExhausted;
+        }
+
+        [[nodiscard]]
+        ReturnT finalize_call(CallInfoT const& call) override
+        {
+            std::shared_ptr<ExpectationT> consumed{};
+            {
+                std::scoped_lock const lock{m_Mx};
+                consumed = m_Consumed;
+            }
+            MIMICPP_ASSERT(consumed, "No row has been consumed.");
+
+            try
+            {
+                advance();
+            }
+            catch (...)
+            {
+                // The call itself has been handled properly. The materialization is retried, when the feed is evaluated
+                // the next time, which then reports the failure.
+            }
+
+            return consumed->finalize_call(call);
+        }
+
+        [[nodiscard]]
+        util::SourceLocation const& from() const noexcept override
+        {
+            return m_From;
+        }
+
+        [[nodiscard]]
+        StringT const& mock_name() const noexcept override
+        {
+            // All rows target the same mock, thus they share the same name.
+            return current()->mock_name();
+        }
+
+    private:
+        std::shared_ptr<CursorT> m_Cursor;
+        util::SourceLocation m_From;
+        StorageT const* m_Target;
+        std::size_t m_SequenceCount;
+        std::tuple<Constness, ValueCategory> m_Qualification;
+        bool m_IsFallback;
+
+        // Guards the following members. The next row may be materialized during any evaluation, thus they are mutable.
+        mutable util::detail::AffineMutex<std::mutex> m_Mx;
+        mutable std::size_t m_RowIndex{};
+        mutable bool m_IsExhausted;
+        // Set, when the current row is saturated, but the next one hasn't been materialized yet.
+        mutable bool m_IsAdvancePending{false};
+        // Set, while a thread materializes the next row. The cursor itself is just accessed by that thread.
+        mutable bool m_IsAdvancing{false};
+        mutable std::shared_ptr<ExpectationT> m_Current{};
+        std::shared_ptr<ExpectationT> m_Consumed{};
+
+        [[nodiscard]]
+        bool is_exhausted() const noexcept
+        {
+            return m_IsExhausted;
+        }
+
+        /**
+         * \brief Materializes the next row, if pending.
+         * \details The factory is invoked without holding the lock, as it may use the targeted mock.
+         * Concurrent and nested invocations just return, while another one is in progress.
+         * \throws Anything, the factory throws. The feed then stays at the current row.
+         */
+        void advance() const
+        {
+            std::unique_lock lock{m_Mx};
+            if (!m_IsAdvancePending
+                || m_IsAdvancing)
+            {
+                return;
+            }
+
+            m_IsAdvancing = true;
+            lock.unlock();
+
+            std::shared_ptr<ExpectationT> next{};
+            bool isExhausted{};
+            try
+            {
+                auto [storage, expectation] = m_Cursor->pull(m_From);
+                MIMICPP_ASSERT(m_Target == storage.get(), "All rows of a feed must target the same mock.");
+                next = std::move(expectation);
+                isExhausted = m_Cursor->is_exhausted();
+            }
+            catch (...)
+            {
+                lock.lock();
+                m_IsAdvancing = false;
+                throw;
+            }
+
+            lock.lock();
+            m_IsAdvancing = false;
+            m_IsAdvancePending = false;
+            m_IsExhausted = isExhausted;
+            m_Current = std::move(next);
+            ++m_RowIndex;
+        }
+
+        [[nodiscard]]
+        std::shared_ptr<ExpectationT> current() const
+        {
+            std::scoped_lock const lock{m_Mx};
+
+            return m_Current;
+        }
+    };
+}
+
+MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
+{
+    /**
+     * \brief Creates the expectations lazily from the rows of a range.
+     * \ingroup EXPECTATION
+     * \tparam Rows The view type.
+     * \tparam Factory The factory type.
+     * \details This is intended for replaying long protocols, where creating all expectations upfront is too expensive.
+     * Instead, each row is turned into an expectation (via the factory), just when it's required.
+     * The rows must be matched in order; the next row is materialized, as soon as the current one becomes saturated
+     * (during the finalization of that call). Thus, at most two rows are materialized at once (the current one and the
+     * one, which is currently finalized). The factory is never invoked while the mock is locked, thus it may use the
+     * mock, too. When the factory throws, the materialization is retried with the next call.
+     *
+     * The whole feed is inserted as a single expectation, which is only satisfied, when all rows have been consumed
+     * and the last one is satisfied. When unfulfilled, the current row is reported, together with its row-index and
+     * the source-location of the feed.
+     *
+     * ```cpp
+     * ScopedExpectation const replay = ExpectationFeed{
+     *     rows,
+     *     [&](Row const& row) { return mock.expect_call(row.arg) and finally::returns(row.result); }};
+     * ```
+     *
+     * \note Rows, which never become saturated (e.g. via ``expect::at_least``), block all of their successors.
+     * \attention All rows must target the same overload of the same mock.
+     * \attention The rows are referenced, when an lvalue-range is provided. Such a range must then outlive the feed.
+     * \attention The current row may change between the selection and the consumption of concurrent calls, thus
+     * feeds should not be called concurrently.
+     */
+    template <std::ranges::view Rows, typename Factory>
+        requires detail::feed_factory_for<Rows, Factory>
+    class ExpectationFeed
+    {
+    public:
+        using StorageT = typename std::remove_cvref_t<detail::feed_builder_t<Rows, Factory>>::StorageT;
+        using ExpectationT = typename StorageT::ExpectationT;
+
+        /**
+         * \brief Constructor.
+         * \param rows The rows, from which the expectations are created.
+         * \param factory Invocable, which creates an expectation (e.g. an ExpectationBuilder) from a single row.
+         */
+        template <std::ranges::viewable_range Range>
+            requires std::constructible_from<Rows, std::views::all_t<Range>>
+        [[nodiscard]]
+        explicit ExpectationFeed(Range&& rows, Factory factory)
+            : m_Rows{std::views::all(std::forward<Range>(rows))},
+              m_Factory{std::move(factory)}
+        {
+        }
+
+        /**
+         * \brief Materializes the first row and inserts the feed into the targeted expectation-collection.
+         * \param sourceLocation The source-location, which is shared by all rows.
+         * \return The owning ScopedExpectation.
+         * \throws std::invalid_argument When the range is empty.
+         */
+        [[nodiscard]]
+        ScopedExpectation finalize(util::SourceLocation sourceLocation) &&
+        {
+            using FeedT = detail::FeedExpectation<StorageT, Rows, Factory>;
+            using CursorT = typename FeedT::CursorT;
+
+            // The targeted mock is just known after the first row has been materialized, thus the cursor is allocated
+            // from the currently selected resource, while the feed itself is allocated from the resource of the mock.
+            auto cursor = std::allocate_shared<CursorT>(
+                std::pmr::polymorphic_allocator<CursorT>{detail::select_memory_resource(nullptr)},
+                std::move(m_Rows),
+                std::move(m_Factory));
+            if (cursor->is_exhausted())
+            {
+                throw std::invalid_argument{"An expectation-feed requires at least one row."};
+            }
+
+            auto [storage, first] = cursor->pull(sourceLocation);
+            auto feed = std::allocate_shared<FeedT>(
+                std::pmr::polymorphic_allocator<FeedT>{storage->memory_resource()},
+                std::move(cursor),
+                *storage,
+                std::move(first),
+                std::move(sourceLocation));
+
+            return ScopedExpectation{
+                std::move(storage),
+                std::move(feed)};
+        }
+
+    private:
+        Rows m_Rows;
+        Factory m_Factory;
+    };
+
+    template <typename Range, typename Factory>
+    ExpectationFeed(Range&&, Factory) -> ExpectationFeed<std::views::all_t<Range>, Factory>;
+}
+
+#endif
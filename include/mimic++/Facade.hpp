@@ -16,8 +16,13 @@
 #include "mimic++/utilities/StaticString.hpp"
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <atomic>
+    #include <concepts>
     #include <cstddef>
+    #include <functional>
     #include <iterator>
+    #include <memory>
+    #include <memory_resource>
     #include <tuple>
     #include <type_traits>
     #include <utility>
@@ -46,6 +51,13 @@ namespace mimicpp
      * As soon as reflection becomes available,
      * an attempt will be made to solve this feature completely in the C++ language (hopefully with c++26, but only time will tell).
      *
+     * ## Lazily constructed member mocks
+     *
+     * The member mocks, which are generated by e.g. ``MAKE_MEMBER_MOCK`` or ``MOCK_METHOD``, are ``mimicpp::facade::LazyMock``s.
+     * They construct the actual ``mimicpp::Mock`` on their first usage, thus untouched methods of large interfaces are almost free.
+     * They can be used like the actual mock (i.e. invoked directly or passed as ``mimicpp::Mock&``); the underlying mock can also
+     * explicitly be accessed via ``get``.
+     *
      * ## Multiple inheritance
      *
      * This use-case is fully supported, without any special tricks.
@@ -121,12 +133,323 @@ namespace mimicpp::facade::detail
     }
 }
 
+MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade
+{
+    /**
+     * \brief A mock, which is just constructed on its first usage.
+     * \ingroup FACADE
+     * \tparam Signatures The signatures of the wrapped mock.
+     * \details Interfaces often consist of dozens of methods, while most tests touch just a few of them.
+     * Untouched member-mocks therefore neither pay for the construction nor for the storage of a full ``Mock``;
+     * they solely consist of the settings-factory and a null pointer.
+     *
+     * The actual mock is constructed on the first ``expect_call``, the first invocation or an explicit ``get``.
+     * This is thread-safe; concurrent first usages agree on a single mock.
+     * It may be invoked directly and converts implicitly to ``Mock&``, thus it can be used wherever the mock itself is expected.
+     * \note The mock is allocated from the memory-resource, which is selected when the mock is actually constructed.
+     * \note When the settings bind the mock to ``ThreadAffinity::owner``, the thread, which uses it first, becomes
+     * its owner; not the thread, which constructed the ``LazyMock``. Call ``get`` upfront to determine the owner
+     * explicitly.
+     */
+    template <typename... Signatures>
+    class LazyMock
+    {
+    public:
+        using MockT = Mock<Signatures...>;
+        using settings_factory_fn = MockSettings (*)();
+
+        /**
+         * \brief Destructor, destroying the mock (if any).
+         */
+        ~LazyMock() noexcept
+        {
+            release(m_Node.load(std::memory_order_acquire));
+        }
+
+        /**
+         * \brief Constructor.
+         * \param makeSettings The function, which creates the settings for the mock.
+         */
+        [[nodiscard]]
+        explicit LazyMock(settings_factory_fn const makeSettings) noexcept
+            : m_MakeSettings{makeSettings}
+        {
+            MIMICPP_ASSERT(m_MakeSettings, "Null settings-factory is not allowed.");
+        }
+
+        /**
+         * \brief Deleted copy constructor.
+         */
+        LazyMock(LazyMock const&) = delete;
+
+        /**
+         * \brief Deleted copy assignment operator.
+         */
+        LazyMock& operator=(LazyMock const&) = delete;
+
+        /**
+         * \brief Move constructor, taking over the mock (if any).
+         * \details The moved-from object constructs a new mock, when it's used again.
+         */
+        [[nodiscard]]
+        LazyMock(LazyMock&& other) noexcept
+            : m_MakeSettings{other.m_MakeSettings},
+              m_Node{other.m_Node.exchange(nullptr, std::memory_order_acq_rel)}
+        {
+        }
+
+        /**
+         * \brief Move assignment operator, taking over the mock (if any).
+         * \details The moved-from object constructs a new mock, when it's used again.
+         */
+        LazyMock& operator=(LazyMock&& other) noexcept
+        {
+            if (this != std::addressof(other))
+            {
+                m_MakeSettings = other.m_MakeSettings;
+                release(
+                    m_Node.exchange(
+                        other.m_Node.exchange(nullptr, std::memory_order_acq_rel),
+                        std::memory_order_acq_rel));
+            }
+
+            return *this;
+        }
+
+        /**
+         * \brief Returns the mock and constructs it, if not already done.
+         */
+        [[nodiscard]]
+        MockT& get()
+        {
+            return materialize();
+        }
+
+        /**
+         * \copydoc get
+         */
+        [[nodiscard]]
+        MockT const& get() const
+        {
+            return materialize();
+        }
+
+        /**
+         * \brief Implicitly converts to the mock and constructs it, if not already done.
+         * \details This keeps ``LazyMock`` a drop-in replacement for ``Mock``, e.g. when passed as ``Mock&``.
+         */
+        [[nodiscard]]
+        operator MockT&()
+        {
+            return materialize();
+        }
+
+        /**
+         * \copydoc operator MockT&
+         */
+        [[nodiscard]]
+        operator MockT const&() const
+        {
+            return materialize();
+        }
+
+        /**
+         * \brief Invokes the mock, which is constructed, if not already done.
+         * \details This is never ``noexcept``, as the construction of the mock may throw, even if the invoked
+         * signature is ``noexcept``.
+         */
+        template <typename... Args>
+            requires std::invocable<MockT&, Args...>
+        decltype(auto) operator()(Args&&... args) &
+        {
+            return std::invoke(get(), std::forward<Args>(args)...);
+        }
+
+        /**
+         * \copydoc operator()
+         */
+        template <typename... Args>
+            requires std::invocable<MockT const&, Args...>
+        decltype(auto) operator()(Args&&... args) const&
+        {
+            return std::invoke(get(), std::forward<Args>(args)...);
+        }
+
+        /**
+         * \copydoc operator()
+         */
+        template <typename... Args>
+            requires std::invocable<MockT&&, Args...>
+        decltype(auto) operator()(Args&&... args) &&
+        {
+            return std::invoke(std::move(get()), std::forward<Args>(args)...);
+        }
+
+        /**
+         * \copydoc operator()
+         */
+        template <typename... Args>
+            requires std::invocable<MockT const&&, Args...>
+        decltype(auto) operator()(Args&&... args) const&&
+        {
+            return std::invoke(std::move(get()), std::forward<Args>(args)...);
+        }
+
+        /**
+         * \brief Determines, whether the mock has already been constructed.
+         */
+        [[nodiscard]]
+        bool is_constructed() const noexcept
+        {
+            return nullptr != m_Node.load(std::memory_order_acquire);
+        }
+
+        /**
+         * \brief Creates a new expectation for the mock, which is constructed, if not already done.
+         */
+        template <typename... Args>
+            requires requires(MockT& mock) { mock.expect_call(std::declval<Args>()...); }
+        [[nodiscard]]
+        auto expect_call(Args&&... args) &
+        {
+            return get().expect_call(std::forward<Args>(args)...);
+        }
+
+        /**
+         * \copydoc expect_call
+         */
+        template <typename... Args>
+            requires requires(MockT const& mock) { mock.expect_call(std::declval<Args>()...); }
+        [[nodiscard]]
+        auto expect_call(Args&&... args) const&
+        {
+            return get().expect_call(std::forward<Args>(args)...);
+        }
+
+        /**
+         * \copydoc expect_call
+         */
+        template <typename... Args>
+            requires requires(MockT&& mock) { std::move(mock).expect_call(std::declval<Args>()...); }
+        [[nodiscard]]
+        auto expect_call(Args&&... args) &&
+        {
+            return std::move(get()).expect_call(std::forward<Args>(args)...);
+        }
+
+        /**
+         * \copydoc expect_call
+         */
+        template <typename... Args>
+            requires requires(MockT const&& mock) { std::move(mock).expect_call(std::declval<Args>()...); }
+        [[nodiscard]]
+        auto expect_call(Args&&... args) const&&
+        {
+            return std::move(get()).expect_call(std::forward<Args>(args)...);
+        }
+
+        /**
+         * \brief Removes all expectations, which are currently attached to the mock.
+         * \details Does nothing, when the mock hasn't been constructed yet.
+         * \see Mock::verify_and_clear
+         */
+        void verify_and_clear()
+        {
+            if (Node* const node = m_Node.load(std::memory_order_acquire))
+            {
+                node->mock.verify_and_clear();
+            }
+        }
+
+    private:
+        // The mock is allocated together with its memory-resource, thus it can be released without storing that separately.
+        struct Node
+        {
+            [[nodiscard]]
+            explicit Node(std::pmr::memory_resource* const memoryResource, MockSettings settings)
+                : resource{memoryResource},
+                  mock{std::move(settings)}
+            {
+            }
+
+            std::pmr::memory_resource* resource;
+            MockT mock;
+        };
+
+        settings_factory_fn m_MakeSettings;
+        mutable std::atomic<Node*> m_Node{};
+
+        static void release(Node* const node) noexcept
+        {
+            if (node)
+            {
+                std::pmr::polymorphic_allocator<Node>{node->resource}.delete_object(node);
+            }
+        }
+
+        [[nodiscard]]
+        MockT& materialize() const
+        {
+            if (Node* const node = m_Node.load(std::memory_order_acquire))
+            {
+                return node->mock;
+            }
+
+            MockSettings settings = std::invoke(m_MakeSettings);
+            settings.memoryResource = mimicpp::detail::select_memory_resource(settings.memoryResource);
+            std::pmr::polymorphic_allocator<Node> alloc{settings.memoryResource};
+            Node* const candidate = alloc.template new_object<Node>(settings.memoryResource, std::move(settings));
+            Node* current{};
+            if (m_Node.compare_exchange_strong(current, candidate, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return candidate->mock;
+            }
+
+            // Another thread has been faster, thus use its mock instead.
+            alloc.delete_object(candidate);
+
+            return current->mock;
+        }
+    };
+}
+
+namespace mimicpp::facade::detail
+{
+    template <template <typename...> typename TargetTemplate>
+    inline constexpr bool is_lazy_target_v = false;
+
+    template <>
+    inline constexpr bool is_lazy_target_v<LazyMock>{true};
+
+    template <typename Target>
+    [[nodiscard]]
+    constexpr Target& resolve_target(Target& target) noexcept
+    {
+        return target;
+    }
+
+    template <typename... Signatures>
+    [[nodiscard]]
+    constexpr auto& resolve_target(LazyMock<Signatures...>& target)
+    {
+        return target.get();
+    }
+
+    template <typename... Signatures>
+    [[nodiscard]]
+    constexpr auto& resolve_target(LazyMock<Signatures...> const& target)
+    {
+        return target.get();
+    }
+}
+
 MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade
 {
     template <template <typename...> typename TargetTemplate>
     struct basic_as_member
     {
         static constexpr bool is_member{true};
+        static constexpr bool is_lazy{detail::is_lazy_target_v<TargetTemplate>};
 
         template <typename... Signatures>
         using target_type = TargetTemplate<Signatures...>;
@@ -137,7 +460,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade
             [[maybe_unused]] auto* const self,
             std::tuple<Args...>&& args)
         {
-            return detail::apply<Signature>(target, std::move(args));
+            return detail::apply<Signature>(detail::resolve_target(target), std::move(args));
         }
 
         template <typename Self>
@@ -147,17 +470,19 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade
             constexpr std::size_t skip = 1u + detail::facadeBaseCallDepth + detail::applyCallDepth;
 
             return MockSettings{
-                .name = detail::generate_member_target_name<Self>(functionName),
-                .stacktraceSkip = skip};
+                .stacktraceSkip = skip,
+                .nameGenerator = &detail::generate_member_target_name<Self>,
+                .nameContext = StringT{functionName}};
         }
     };
 
-    using mock_as_member = basic_as_member<Mock>;
+    using mock_as_member = basic_as_member<LazyMock>;
 
     template <typename Self, template <typename...> typename TargetTemplate>
     struct basic_as_member_with_this
     {
         static constexpr bool is_member{true};
+        static constexpr bool is_lazy{detail::is_lazy_target_v<TargetTemplate>};
 
         template <typename Signature, bool isConst = Constness::as_const == signature_const_qualification_v<Signature>>
         using prepend_this = signature_prepend_param_t<
@@ -171,7 +496,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade
         static constexpr decltype(auto) invoke(auto& target, auto* const self, std::tuple<Args...>&& args)
         {
             return detail::apply<Signature>(
-                target,
+                detail::resolve_target(target),
                 std::tuple_cat(std::make_tuple(self), std::move(args)));
         }
 
@@ -181,13 +506,14 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade
             constexpr std::size_t skip = 1u + detail::facadeBaseCallDepth + detail::applyCallDepth;
 
             return MockSettings{
-                .name = detail::generate_member_target_name<Self>(functionName),
-                .stacktraceSkip = skip};
+                .stacktraceSkip = skip,
+                .nameGenerator = &detail::generate_member_target_name<Self>,
+                .nameContext = StringT{functionName}};
         }
     };
 
     template <typename Self>
-    using mock_as_member_with_this = basic_as_member_with_this<Self, Mock>;
+    using mock_as_member_with_this = basic_as_member_with_this<Self, LazyMock>;
 }
 
 // These symbols are called from within "exported" macros and must thus be visible to the caller.
@@ -200,6 +526,13 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::facade::detail
         requires requires { Traits::is_member; }
     inline constexpr bool is_member_v<Traits>{Traits::is_member};
 
+    template <typename Traits>
+    inline constexpr bool is_lazy_v = false;
+
+    template <typename Traits>
+        requires requires { Traits::is_lazy; }
+    inline constexpr bool is_lazy_v<Traits>{Traits::is_lazy};
+
     template <auto specText>
     struct apply_normalized_specs
     {
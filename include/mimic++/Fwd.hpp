@@ -37,6 +37,30 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         any = lvalue | rvalue
     };
 
+    /**
+     * \brief Determines, from which threads an object may be used.
+     * \details ``any`` permits concurrent usage from arbitrary threads,
+     * while ``owner`` restricts the usage to the thread, which created the object.
+     */
+    enum class ThreadAffinity
+    {
+        any,
+        owner
+    };
+
+    /**
+     * \brief Determines, how concurrent calls of the same mock are handled.
+     * \details ``serialized`` handles each call under exclusive access, thus the requirements of the expectations
+     * (e.g. stateful predicate matchers) are never evaluated concurrently.
+     * ``optimistic`` evaluates the requirements of concurrent calls in parallel and just serializes, what depends on the
+     * state of the expectations. The requirements must then not rely on any unsynchronized mutable state.
+     */
+    enum class CallConcurrency
+    {
+        serialized,
+        optimistic
+    };
+
     /**
      * \brief Primary template, purposely undefined.
      * \ingroup TYPE_TRAITS_SIGNATURE_ADD_NOEXCEPT
@@ -385,6 +409,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
     class ExpectationCollection;
 
     class ScopedExpectation;
+    class ScopedExpectationBatch;
 
     using CharT = char;
     using CharTraitsT = std::char_traits<CharT>;
@@ -394,6 +419,10 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
     template <typename FirstSignature, typename... OtherSignatures>
         requires is_overload_set_v<FirstSignature, OtherSignatures...>
     class Mock;
+
+    template <typename FirstSignature, typename... OtherSignatures>
+        requires is_overload_set_v<FirstSignature, OtherSignatures...>
+    class Stub;
 }
 
 namespace mimicpp::sequence
@@ -415,6 +444,15 @@ namespace mimicpp::sequence
         friend bool operator==(rating const&, rating const&) = default;
     };
 
+    struct position
+    {
+        Tag tag{};
+        int index{};
+
+        [[nodiscard]]
+        friend bool operator==(position const&, position const&) = default;
+    };
+
     namespace detail
     {
         template <typename Id, auto priorityStrategy>
@@ -23,6 +23,8 @@
 #ifndef MIMICPP_DETAIL_IS_MODULE
     #include <cstddef>
     #include <functional>
+    #include <memory>
+    #include <memory_resource>
     #include <optional>
     #include <tuple>
     #include <type_traits>
@@ -35,7 +37,48 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
     {
     public:
         std::optional<StringT> name{};
+
         std::size_t stacktraceSkip{};
+
+        /**
+         * \brief Determines, from which threads the mock may be used.
+         * \details Mocks, which are bound to their ``ThreadAffinity::owner``, skip all internal synchronization and must
+         * therefore exclusively be used by the thread, which created them. Debug-builds report each violation as error.
+         */
+        ThreadAffinity threadAffinity{ThreadAffinity::any};
+
+        /**
+         * \brief Determines, that just every n-th call of the mock is fully verified.
+         * \details All other calls are directly dispatched to the most recently verified expectation, without evaluating
+         * its requirements or reporting the match. The expectations are still consumed as usual, thus their times-checks
+         * are accounted for. This is intended for mocks, which are used as lightweight stand-ins (e.g. in benchmarks).
+         * ``0`` and ``1`` verify each call.
+         */
+        std::size_t verificationInterval{1u};
+
+        /**
+         * \brief The memory-resource, which is used for the expectation-storage and all expectations of the mock.
+         * \details ``nullptr`` selects the current ``settings::memory_resource``.
+         * \attention The resource must outlive the mock and all of its expectations.
+         */
+        std::pmr::memory_resource* memoryResource{};
+
+        /**
+         * \brief Generates the mock-name on demand, when no explicit ``name`` is given.
+         * \details The generator is invoked at most once per overload and just when the name is actually required
+         * (e.g. when a report is created). It receives the ``nameContext`` as argument.
+         * When neither a ``name`` nor a ``nameGenerator`` is given, the name is generated from the signatures.
+         */
+        reporting::TargetReport::name_generator_fn nameGenerator{};
+        StringT nameContext{};
+
+        /**
+         * \brief Determines, how concurrent calls of the mock are handled.
+         * \details By default, each call is handled under exclusive access. ``CallConcurrency::optimistic`` evaluates the
+         * requirements of concurrent calls in parallel, which requires them to be thread-safe.
+         * \see ExpectationCollection::handle_call
+         */
+        CallConcurrency callConcurrency{CallConcurrency::serialized};
     };
 }
 
@@ -323,44 +366,73 @@ namespace mimicpp::detail
         [[nodiscard]]
         explicit BasicMock(
             ExpectationCollectionPtrT collection,
-            MockSettings settings) noexcept
+            MockSettings const& settings)
             : m_Expectations{std::move(collection)},
-              m_Settings{std::move(settings)}
+              m_Target{make_target_report(settings)},
+              m_StacktraceSkip{settings.stacktraceSkip + 2u} // skips the operator() and the handle_call from the stacktrace
         {
-            MIMICPP_ASSERT(m_Settings.name, "Empty mock-name.");
+        }
 
-            m_Settings.stacktraceSkip += 2u; // skips the operator() and the handle_call from the stacktrace
+        // Removes all expectations, but defers the report of the unsatisfied ones to the returned invocable.
+        [[nodiscard]]
+        auto clear_expectations()
+        {
+            return [unfulfilled = m_Expectations->release_all()] {
+                ExpectationCollectionPtrT::element_type::report_unfulfilled(unfulfilled);
+            };
         }
 
     private:
+        [[nodiscard]]
+        static reporting::TargetReport make_target_report(MockSettings const& settings)
+        {
+            if (settings.name)
+            {
+                return reporting::TargetReport{
+                    *settings.name,
+                    reporting::TypeReport::make<SignatureT>()};
+            }
+
+            MIMICPP_ASSERT(settings.nameGenerator, "Empty mock-name.");
+
+            return reporting::TargetReport{
+                settings.nameGenerator,
+                settings.nameContext,
+                reporting::TypeReport::make<SignatureT>()};
+        }
+
         ExpectationCollectionPtrT m_Expectations;
-        MockSettings m_Settings;
+        // Interned once, thus neither calls nor expectations have to copy the mock-name.
+        reporting::TargetReport m_Target;
+        std::size_t m_StacktraceSkip;
 
         [[nodiscard]]
         constexpr signature_return_type_t<SignatureT> handle_call(
-            reporting::TypeReport overloadReport,
+            [[maybe_unused]] reporting::TypeReport const& overloadReport,
             std::tuple<std::reference_wrapper<std::remove_reference_t<Params>>...>&& params,
             util::SourceLocation from) const
         {
+            MIMICPP_ASSERT(overloadReport == m_Target.overload_report(), "Overload-report mismatch.");
+
             return m_Expectations->handle_call(
-                reporting::TargetReport{
-                    .name{*m_Settings.name},
-                    .overloadReport{std::move(overloadReport)}},
+                m_Target,
                 call::info_for_signature_t<SignatureT>{
                     .args{std::move(params)},
                     .fromCategory{refQualification},
                     .fromConstness{constQualification},
                     .fromSourceLocation{std::move(from)},
-                    .baseStacktraceSkip{m_Settings.stacktraceSkip}});
+                    .baseStacktraceSkip{m_StacktraceSkip}});
         }
 
         template <typename... Args>
         [[nodiscard]]
-        constexpr auto make_expectation_builder(reporting::TypeReport overloadReport, Args&&... args) const
+        constexpr auto make_expectation_builder([[maybe_unused]] reporting::TypeReport const& overloadReport, Args&&... args) const
         {
+            MIMICPP_ASSERT(overloadReport == m_Target.overload_report(), "Overload-report mismatch.");
+
             return detail::make_expectation_builder(
                        m_Expectations,
-                       reporting::TargetReport{.name = *m_Settings.name, .overloadReport = std::move(overloadReport)},
+                       m_Target,
                        std::forward<Args>(args)...)
                 && expectation_policies::Category<refQualification>{}
                 && expectation_policies::Constness<constQualification>{};
@@ -374,10 +446,18 @@ namespace mimicpp::detail
     struct expectation_collection_factory<util::type_list<UniqueSignatures...>>
     {
         [[nodiscard]]
-        static auto make()
+        static auto make(MockSettings const& settings)
         {
+            std::pmr::memory_resource* const resource = select_memory_resource(settings.memoryResource);
+
             return std::tuple{
-                std::make_shared<ExpectationCollection<UniqueSignatures>>()...};
+                std::allocate_shared<ExpectationCollection<UniqueSignatures>>(
+                    std::pmr::polymorphic_allocator<ExpectationCollection<UniqueSignatures>>{resource},
+                    ExpectationCollectionSettings{
+                        .threadAffinity = settings.threadAffinity,
+                        .verificationInterval = settings.verificationInterval,
+                        .memoryResource = resource,
+                        .callConcurrency = settings.callConcurrency})...};
         }
     };
 
@@ -491,7 +571,7 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
                   detail::expectation_collection_factory<
                       util::detail::unique_list_t<
                           signature_decay_t<FirstSignature>,
-                          signature_decay_t<OtherSignatures>...>>::make(),
+                          signature_decay_t<OtherSignatures>...>>::make(settings),
                   complete_settings(std::move(settings))}
         {
         }
@@ -517,10 +597,32 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
          */
         Mock& operator=(Mock&&) = default;
 
+        /**
+         * \brief Removes all expectations, which are currently attached to this mock.
+         * \details Each unsatisfied expectation is reported as "unfulfilled expectation", as if its owner had been destroyed.
+         * The owners themselves (e.g. ``ScopedExpectation``) stay valid, but are no longer attached to this mock;
+         * thus their destruction doesn't verify the expectations again.
+         *
+         * The expectations of all overloads are removed, before anything is reported. Thus, none of them stays attached,
+         * even if a report aborts via an exception.
+         *
+         * The mock keeps its name and its internal storage, thus it can be cheaply reused for subsequent expectations
+         * (e.g. by each iteration of a parameterized test).
+         */
+        void verify_and_clear()
+        {
+            std::tuple const reports{
+                detail::BasicMock<FirstSignature>::clear_expectations(),
+                detail::BasicMock<OtherSignatures>::clear_expectations()...};
+            std::apply(
+                [](auto const&... report) { (..., report()); },
+                reports);
+        }
+
     private:
         template <typename... Collections>
         [[nodiscard]]
-        explicit Mock(std::tuple<Collections...> collections, MockSettings const& settings) noexcept
+        explicit Mock(std::tuple<Collections...> collections, MockSettings const& settings)
             // clang-format off
             : detail::BasicMock<FirstSignature>{
                 util::detail::get<detail::expectation_collection_ptr_for<FirstSignature>>(collections),
@@ -535,9 +637,13 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
         [[nodiscard]]
         static MockSettings complete_settings(MockSettings settings)
         {
-            if (!settings.name)
+            if (!settings.name
+                && !settings.nameGenerator)
             {
-                settings.name = detail::generate_mock_name<FirstSignature, OtherSignatures...>();
+                // The name is just generated, when it's actually required.
+                settings.nameGenerator = []([[maybe_unused]] StringViewT const context) {
+                    return detail::generate_mock_name<FirstSignature, OtherSignatures...>();
+                };
             }
 
             return settings;
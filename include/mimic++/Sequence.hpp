@@ -10,6 +10,7 @@
 
 #include "mimic++/Fwd.hpp"
 #include "mimic++/config/Config.hpp"
+#include "mimic++/config/Settings.hpp"
 #include "mimic++/printing/Format.hpp"
 #include "mimic++/reporting/GlobalReporter.hpp"
 #include "mimic++/utilities/C++20Compatibility.hpp"
@@ -22,6 +23,9 @@
     #include <algorithm>
     #include <array>
     #include <functional>
+    #include <memory>
+    #include <memory_resource>
+    #include <optional>
     #include <span>
     #include <tuple>
 #endif
@@ -103,23 +107,28 @@ namespace mimicpp::sequence::detail
 
         ~BasicSequence() noexcept(false)
         {
-            auto const iter = std::ranges::find_if_not(m_Entries, &Entry::is_fulfilled);
-            auto const satisfiedCount = std::ranges::distance(m_Entries.cbegin(), iter);
+            std::span const entries = this->entries();
+            auto const iter = std::ranges::find_if_not(entries, &Entry::is_fulfilled);
+            auto const satisfiedCount = std::ranges::distance(entries.begin(), iter);
             MIMICPP_ASSERT(m_Cursor <= satisfiedCount, "Cursor skipped unsatisfied entries.");
 
-            if (iter != m_Entries.cend())
+            if (iter != entries.end())
             {
                 reporting::detail::report_error(
                     format::format(
                         "Unfulfilled sequence. {} out of {} expectation(s) are satisfied.",
                         satisfiedCount,
-                        m_Entries.size()));
+                        entries.size()));
             }
         }
 
+        // A nullptr resource selects the current settings::memory_resource, when the first entry is added.
         [[nodiscard]]
-        explicit constexpr BasicSequence(util::SourceLocation loc = {}) noexcept
-            : m_Loc{std::move(loc)}
+        explicit constexpr BasicSequence(
+            util::SourceLocation loc = {},
+            std::pmr::memory_resource* const resource = nullptr) noexcept
+            : m_Loc{std::move(loc)},
+              m_MemoryResource{resource}
         {
         }
 
@@ -132,7 +141,7 @@ namespace mimicpp::sequence::detail
         [[nodiscard]]
         constexpr std::optional<util::SourceLocation> head_from() const
         {
-            auto const pending = std::span{m_Entries}.subspan(m_Cursor);
+            auto const pending = entries().subspan(m_Cursor);
             auto const iter = std::ranges::find_if(pending, &Entry::is_active);
             if (iter != pending.end())
             {
@@ -160,7 +169,7 @@ namespace mimicpp::sequence::detail
             MIMICPP_ASSERT(is_valid(id), "Invalid id given.");
             MIMICPP_ASSERT(m_Cursor <= util::to_underlying(id), "Invalid state.");
 
-            auto& element = m_Entries[util::to_underlying(id)];
+            auto& element = entries()[util::to_underlying(id)];
             MIMICPP_ASSERT(element.is_unsatisfied(), "Element is in unexpected state.");
             element.state = State::satisfied;
         }
@@ -171,7 +180,7 @@ namespace mimicpp::sequence::detail
             int const index = util::to_underlying(id);
             MIMICPP_ASSERT(m_Cursor <= index, "Invalid state.");
 
-            auto& element = m_Entries[index];
+            auto& element = entries()[index];
             MIMICPP_ASSERT(element.is_active(), "Element is in unexpected state.");
             element.state = State::saturated;
         }
@@ -181,7 +190,7 @@ namespace mimicpp::sequence::detail
         {
             MIMICPP_ASSERT(is_valid(id), "Invalid id given.");
 
-            std::span const pending = std::span{m_Entries}.subspan(m_Cursor);
+            std::span const pending = entries().subspan(m_Cursor);
             auto const index = util::to_underlying(id) - m_Cursor;
 
             return 0 <= index
@@ -199,15 +208,20 @@ namespace mimicpp::sequence::detail
         [[nodiscard]]
         constexpr Id add(util::SourceLocation info)
         {
-            if (!std::in_range<std::underlying_type_t<Id>>(m_Entries.size()))
+            if (!std::in_range<std::underlying_type_t<Id>>(entries().size()))
                 [[unlikely]]
             {
                 throw std::runtime_error{"Sequence already holds maximum amount of elements."};
             }
 
-            m_Entries.emplace_back(State::unsatisfied, std::move(info));
+            if (!m_Entries)
+            {
+                m_Entries.emplace(mimicpp::detail::select_memory_resource(m_MemoryResource));
+            }
 
-            return static_cast<Id>(m_Entries.size() - 1);
+            m_Entries->emplace_back(State::unsatisfied, std::move(info));
+
+            return static_cast<Id>(m_Entries->size() - 1);
         }
 
         [[nodiscard]]
@@ -252,16 +266,30 @@ namespace mimicpp::sequence::detail
             }
         };
 
-        std::vector<Entry> m_Entries{};
+        // The storage is created with the first entry, thus the construction doesn't depend on the resource lookup.
+        std::pmr::memory_resource* m_MemoryResource;
+        std::optional<std::pmr::vector<Entry>> m_Entries{};
         int m_Cursor{};
 
+        [[nodiscard]]
+        constexpr std::span<Entry> entries() noexcept
+        {
+            return m_Entries ? std::span{*m_Entries} : std::span<Entry>{};
+        }
+
+        [[nodiscard]]
+        constexpr std::span<Entry const> entries() const noexcept
+        {
+            return m_Entries ? std::span{*m_Entries} : std::span<Entry const>{};
+        }
+
         [[nodiscard]]
         constexpr bool is_valid(Id const id) const noexcept
         {
             auto const index = util::to_underlying(id);
 
             return 0 <= index
-                && index < std::ssize(m_Entries);
+                && index < std::ssize(entries());
         }
     };
 
@@ -308,7 +336,8 @@ namespace mimicpp::sequence::detail
 
         [[nodiscard]]
         explicit BasicSequenceInterface(util::SourceLocation loc = {})
-            : m_Sequence{std::make_shared<Sequence>(std::move(loc))}
+            : m_Sequence{
+                  make_sequence(mimicpp::detail::select_memory_resource(nullptr), std::move(loc))}
         {
         }
 
@@ -343,6 +372,15 @@ namespace mimicpp::sequence::detail
 
     private:
         std::shared_ptr<Sequence> m_Sequence;
+
+        [[nodiscard]]
+        static std::shared_ptr<Sequence> make_sequence(std::pmr::memory_resource* const resource, util::SourceLocation loc)
+        {
+            return std::allocate_shared<Sequence>(
+                std::pmr::polymorphic_allocator<Sequence>{resource},
+                std::move(loc),
+                resource);
+        }
     };
 
     template <typename... Sequences>
@@ -0,0 +1,305 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_STUB_HPP
+#define MIMICPP_STUB_HPP
+
+#pragma once
+
+#include "mimic++/Call.hpp"
+#include "mimic++/CallConvention.hpp"
+#include "mimic++/Expectation.hpp"
+#include "mimic++/Fwd.hpp"
+#include "mimic++/TypeTraits.hpp"
+#include "mimic++/config/Config.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+#include "mimic++/reporting/CallReport.hpp"
+#include "mimic++/reporting/GlobalReporter.hpp"
+#include "mimic++/reporting/TargetReport.hpp"
+#include "mimic++/reporting/TypeReport.hpp"
+#include "mimic++/utilities/SourceLocation.hpp"
+#include "mimic++/utilities/Stacktrace.hpp"
+#include "mimic++/utilities/TypeList.hpp"
+
+#ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <concepts>
+    #include <cstddef>
+    #include <functional>
+    #include <memory>
+    #include <tuple>
+    #include <type_traits>
+    #include <utility>
+#endif
+
+namespace mimicpp::detail
+{
+    template <typename Signature>
+    class StubBehavior
+    {
+    public:
+        virtual ~StubBehavior() = default;
+
+        [[nodiscard]]
+        virtual signature_return_type_t<Signature> finalize_call(call::info_for_signature_t<Signature> const& info) = 0;
+
+    protected:
+        [[nodiscard]]
+        StubBehavior() = default;
+
+        StubBehavior(StubBehavior const&) = default;
+        StubBehavior& operator=(StubBehavior const&) = default;
+        StubBehavior(StubBehavior&&) = default;
+        StubBehavior& operator=(StubBehavior&&) = default;
+    };
+
+    template <typename Signature, finalize_policy_for<Signature> FinalizePolicy>
+    class BasicStubBehavior final
+        : public StubBehavior<Signature>
+    {
+    public:
+        [[nodiscard]]
+        explicit BasicStubBehavior(FinalizePolicy policy) noexcept(std::is_nothrow_move_constructible_v<FinalizePolicy>)
+            : m_Policy{std::move(policy)}
+        {
+        }
+
+        [[nodiscard]]
+        signature_return_type_t<Signature> finalize_call(call::info_for_signature_t<Signature> const& info) override
+        {
+            return m_Policy.finalize_call(info);
+        }
+
+    private:
+        FinalizePolicy m_Policy;
+    };
+
+    template <typename Action, typename Signature, typename ParamList = signature_param_list_t<Signature>>
+    struct is_stub_action_for
+        : public std::false_type
+    {
+    };
+
+    template <typename Action, typename Signature, typename... Params>
+    struct is_stub_action_for<Action, Signature, util::type_list<Params...>>
+        : public std::bool_constant<
+              std::is_invocable_r_v<
+                  signature_return_type_t<Signature>,
+                  Action&,
+                  std::remove_reference_t<Params>&...>>
+    {
+    };
+
+    /**
+     * \brief Determines, whether the given type can be bound as behavior of the given stub-overload.
+     * \details Accepts either a finalize-policy or any action, which is invocable with all call-arguments.
+     */
+    template <typename Behavior, typename Signature>
+    concept stub_behavior_for = std::is_constructible_v<std::remove_cvref_t<Behavior>, Behavior>
+                             && (finalize_policy_for<std::remove_cvref_t<Behavior>, signature_decay_t<Signature>>
+                                 || is_stub_action_for<std::remove_cvref_t<Behavior>, signature_decay_t<Signature>>::value);
+
+    template <typename Signature, typename ParamList = signature_param_list_t<Signature>>
+    class BasicStub;
+
+    template <typename Signature, typename... Params>
+    class BasicStub<Signature, util::type_list<Params...>>
+        : public call_interface_t<
+              BasicStub<Signature, util::type_list<Params...>>,
+              Signature>
+    {
+        using SignatureT = signature_remove_call_convention_t<Signature>;
+        using DecayedSignatureT = signature_decay_t<Signature>;
+        using BehaviorT = StubBehavior<DecayedSignatureT>;
+
+        friend call_interface_t<BasicStub, Signature>;
+
+        static constexpr Constness constQualification = signature_const_qualification_v<SignatureT>;
+        static constexpr ValueCategory refQualification = signature_ref_qualification_v<SignatureT>;
+
+    public:
+        template <stub_behavior_for<Signature> Behavior>
+        void bind(Behavior&& behavior)
+        {
+            using PolicyT = std::remove_cvref_t<Behavior>;
+            if constexpr (finalize_policy_for<PolicyT, DecayedSignatureT>)
+            {
+                m_Behavior = std::make_unique<BasicStubBehavior<DecayedSignatureT, PolicyT>>(
+                    std::forward<Behavior>(behavior));
+            }
+            else
+            {
+                auto policy = finally::returns_apply_all_result_of(std::forward<Behavior>(behavior));
+                m_Behavior = std::make_unique<BasicStubBehavior<DecayedSignatureT, decltype(policy)>>(
+                    std::move(policy));
+            }
+        }
+
+    protected:
+        [[nodiscard]]
+        BasicStub() = default;
+
+    private:
+        std::unique_ptr<BehaviorT> m_Behavior{};
+
+        [[nodiscard]]
+        signature_return_type_t<SignatureT> handle_call(
+            [[maybe_unused]] reporting::TypeReport const& overloadReport,
+            std::tuple<std::reference_wrapper<std::remove_reference_t<Params>>...>&& params,
+            util::SourceLocation from) const
+        {
+            call::info_for_signature_t<SignatureT> info{
+                .args{std::move(params)},
+                .fromCategory{refQualification},
+                .fromConstness{constQualification},
+                .fromSourceLocation{std::move(from)},
+                .baseStacktraceSkip{2u}}; // skips the operator() and the handle_call from the stacktrace
+
+            if (!m_Behavior)
+            {
+                if constexpr (std::is_void_v<signature_return_type_t<SignatureT>>)
+                {
+                    return;
+                }
+                else
+                {
+                    // There is no value, which could be returned; thus it's treated like a mock-call without expectations.
+                    std::size_t const stacktraceSkip{1u + info.baseStacktraceSkip};
+                    reporting::detail::report_no_matches(
+                        reporting::make_call_report(
+                            reporting::TargetReport{"Stub", overloadReport},
+                            std::move(info),
+                            util::stacktrace::current(stacktraceSkip)),
+                        {});
+                }
+            }
+
+            return m_Behavior->finalize_call(info);
+        }
+    };
+}
+
+MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
+{
+    /**
+     * \brief A lightweight test-double, which just provides canned behavior for its overload set.
+     * \ingroup MOCK
+     * \tparam FirstSignature The first signature.
+     * \tparam OtherSignatures Other signatures.
+     * \details Stubs provide the same call-operators as ``Mock`` (including any registered call-convention), but don't
+     * support expectations. Each call is directly dispatched to the behavior, which has been bound to the called
+     * overload; there is no expectation-collection and no synchronization involved.
+     *
+     * A behavior is either a finalize-policy (e.g. ``finally::returns``) or any action, which is invocable with
+     * all call-arguments (as lvalue-references).
+     * Calls to overloads without a bound behavior simply return, when the return type is ``void``. Otherwise, they are
+     * reported as unmatched calls (see ``IReporter::report_no_matches``), as it's done for mocks without expectations.
+     * As the reporter must not return, ``noexcept`` overloads terminate in that case (like ``noexcept`` mocks do).
+     *
+     * \attention Binding a behavior is not synchronized with concurrent calls.
+     */
+    template <typename FirstSignature, typename... OtherSignatures>
+        requires is_overload_set_v<FirstSignature, OtherSignatures...>
+    class Stub
+        : public detail::BasicStub<FirstSignature>,
+          public detail::BasicStub<OtherSignatures>...
+    {
+        template <typename Signature>
+        static constexpr bool is_target = (std::same_as<Signature, FirstSignature> || ... || std::same_as<Signature, OtherSignatures>);
+
+        template <typename Behavior>
+        static constexpr std::size_t applicable_count = std::size_t{detail::stub_behavior_for<Behavior, FirstSignature>}
+                                                      + (0u + ... + std::size_t{detail::stub_behavior_for<Behavior, OtherSignatures>});
+
+    public:
+        using detail::BasicStub<FirstSignature>::operator();
+        using detail::BasicStub<OtherSignatures>::operator()...;
+
+        /**
+         * \brief Defaulted destructor.
+         */
+        ~Stub() = default;
+
+        /**
+         * \brief Defaulted default constructor.
+         */
+        [[nodiscard]]
+        Stub() = default;
+
+        /**
+         * \brief Deleted copy constructor.
+         */
+        Stub(Stub const&) = delete;
+
+        /**
+         * \brief Deleted copy assignment operator.
+         */
+        Stub& operator=(Stub const&) = delete;
+
+        /**
+         * \brief Defaulted move constructor.
+         */
+        [[nodiscard]]
+        Stub(Stub&&) = default;
+
+        /**
+         * \brief Defaulted move assignment operator.
+         */
+        Stub& operator=(Stub&&) = default;
+
+        /**
+         * \brief Binds the given behavior to the selected overloads.
+         * \tparam Targets The selected signatures. If empty, all overloads are selected, which accept the behavior.
+         * \tparam Behavior The behavior type.
+         * \param behavior The behavior to be bound.
+         * \return A reference to this stub.
+         * \details Any previously bound behavior of the selected overloads is replaced.
+         * The behavior is copied, when multiple overloads are selected.
+         */
+        template <typename... Targets, typename Behavior>
+            requires(0u == sizeof...(Targets) && 0u < applicable_count<Behavior>)
+                 || (0u < sizeof...(Targets)
+                     && (... && is_target<Targets>)
+                     && (... && detail::stub_behavior_for<Behavior, Targets>))
+        Stub& bind(Behavior&& behavior)
+        {
+            if constexpr (0u == sizeof...(Targets))
+            {
+                constexpr bool isUnique = 1u == applicable_count<Behavior>;
+                bind_if_applicable<FirstSignature, isUnique, Behavior>(behavior);
+                (..., bind_if_applicable<OtherSignatures, isUnique, Behavior>(behavior));
+            }
+            else if constexpr (1u == sizeof...(Targets))
+            {
+                (..., static_cast<detail::BasicStub<Targets>&>(*this).bind(std::forward<Behavior>(behavior)));
+            }
+            else
+            {
+                (..., static_cast<detail::BasicStub<Targets>&>(*this).bind(std::as_const(behavior)));
+            }
+
+            return *this;
+        }
+
+    private:
+        template <typename Signature, bool isUnique, typename Behavior>
+        void bind_if_applicable(std::remove_reference_t<Behavior>& behavior)
+        {
+            if constexpr (detail::stub_behavior_for<Behavior, Signature>)
+            {
+                auto& target = static_cast<detail::BasicStub<Signature>&>(*this);
+                if constexpr (isUnique)
+                {
+                    target.bind(std::forward<Behavior>(behavior));
+                }
+                else
+                {
+                    target.bind(std::as_const(behavior));
+                }
+            }
+        }
+    };
+}
+
+#endif
@@ -6,11 +6,13 @@
 #ifndef MIMICPP_UTILITIES_HPP
 #define MIMICPP_UTILITIES_HPP
 
+#include "mimic++/utilities/AffineMutex.hpp"
 #include "mimic++/utilities/Algorithm.hpp"
 #include "mimic++/utilities/AlwaysFalse.hpp"
 #include "mimic++/utilities/C++23Backports.hpp"
 #include "mimic++/utilities/C++26Backports.hpp"
 #include "mimic++/utilities/Concepts.hpp"
+#include "mimic++/utilities/ParallelFor.hpp"
 #include "mimic++/utilities/PassKey.hpp"
 #include "mimic++/utilities/PriorityTag.hpp"
 #include "mimic++/utilities/SourceLocation.hpp"
@@ -10,6 +10,8 @@
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
     #include <atomic>
+    #include <limits>
+    #include <memory_resource>
 #endif
 
 MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::settings
@@ -50,9 +52,114 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::settings
         return value;
     }
 
+    /**
+     * \brief Controls the amount of candidates, from which on the requirements of expectations are evaluated in parallel.
+     * \details Collections with a huge amount of expectations, which can not be indexed (e.g. due to predicate matchers),
+     * may benefit from spreading the evaluation over multiple threads. The selected expectation is always the same,
+     * as it would be during a sequential evaluation.
+     * This is disabled by default, and never applied to mocks, which are bound to a single thread.
+     * The evaluation is distributed over a pool of persistent threads, thus the dispatch itself is cheap. Nevertheless,
+     * for cheap requirements (e.g. plain comparisons), it typically just pays off from about ``4096`` candidates on.
+     * Expensive requirements may justify lower values. The ``ExpectationCollection`` benchmarks measure the crossover
+     * on the actual machine.
+     * \attention When enabled, the requirements of such expectations may be evaluated by arbitrary threads.
+     * \returns a mutable reference to the actual settings value.
+     */
+    [[nodiscard]]
+    inline std::atomic_size_t& parallel_evaluation_threshold() noexcept
+    {
+        static std::atomic_size_t value{std::numeric_limits<std::size_t>::max()};
+
+        return value;
+    }
+
+    /**
+     * \brief Controls the maximal amount of threads, which participate in a parallel evaluation.
+     * \details The calling thread is included in that amount. The default value ``0`` selects the amount of
+     * concurrent threads, which are supported by the hardware.
+     * \returns a mutable reference to the actual settings value.
+     */
+    [[nodiscard]]
+    inline std::atomic_size_t& parallel_evaluation_workers() noexcept
+    {
+        static std::atomic_size_t value{0u};
+
+        return value;
+    }
+
+    /**
+     * \brief Controls the memory-resource, which is used by default for the internal allocations.
+     * \details Mocks and sequences acquire the resource during their construction and use it for their whole
+     * lifetime. ``MockSettings::memoryResource`` overrides it per mock. ``nullptr`` (the default) selects
+     * ``std::pmr::get_default_resource()``.
+     * \attention The resource must outlive all objects, which have been constructed while it was selected.
+     * \returns a mutable reference to the actual settings value.
+     */
+    [[nodiscard]]
+    inline std::atomic<std::pmr::memory_resource*>& memory_resource() noexcept
+    {
+        static std::atomic<std::pmr::memory_resource*> value{nullptr};
+
+        return value;
+    }
+
+    /**
+     * \brief Selects the given memory-resource as default for its lifetime.
+     * \details The previously selected resource is restored during destruction.
+     * \see settings::memory_resource
+     */
+    class ScopedMemoryResource
+    {
+    public:
+        /**
+         * \brief Selects the given resource.
+         * \param resource The resource to be selected.
+         */
+        [[nodiscard]]
+        explicit ScopedMemoryResource(std::pmr::memory_resource& resource) noexcept
+            : m_Previous{memory_resource().exchange(&resource)}
+        {
+        }
+
+        /**
+         * \brief Restores the previously selected resource.
+         */
+        ~ScopedMemoryResource() noexcept
+        {
+            memory_resource().store(m_Previous);
+        }
+
+        ScopedMemoryResource(ScopedMemoryResource const&) = delete;
+        ScopedMemoryResource& operator=(ScopedMemoryResource const&) = delete;
+        ScopedMemoryResource(ScopedMemoryResource&&) = delete;
+        ScopedMemoryResource& operator=(ScopedMemoryResource&&) = delete;
+
+    private:
+        std::pmr::memory_resource* m_Previous;
+    };
+
     /**
      * \}
      */
 }
 
+namespace mimicpp::detail
+{
+    [[nodiscard]]
+    inline std::pmr::memory_resource* select_memory_resource(std::pmr::memory_resource* const resource) noexcept
+    {
+        if (resource)
+        {
+            return resource;
+        }
+
+        if (std::pmr::memory_resource* const selected = settings::memory_resource().load())
+        {
+            return selected;
+        }
+
+        return std::pmr::get_default_resource();
+    }
+}
+
 #endif
@@ -212,7 +212,12 @@ namespace mimicpp
     linkage typename traits::template target_type<MIMICPP_DETAIL_STRIP_PARENS(signatures)> target_name \
     {                                                                                                  \
         [&]<typename T = traits>() {                                                                   \
-            if constexpr (::mimicpp::facade::detail::is_member_v<T>)                                   \
+            if constexpr (::mimicpp::facade::detail::is_lazy_v<T>)                                     \
+            {                                                                                          \
+                using Self = ::std::remove_cvref_t<decltype(*this)>;                                   \
+                return [] { return T::make_settings(static_cast<Self const*>(nullptr), #fn_name); };   \
+            }                                                                                          \
+            else if constexpr (::mimicpp::facade::detail::is_member_v<T>)                              \
             {                                                                                          \
                 return T::make_settings(this, #fn_name);                                               \
             }                                                                                          \
@@ -17,7 +17,10 @@
 #include "mimic++/utilities/Concepts.hpp"
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <concepts>
+    #include <cstddef>
     #include <functional>
+    #include <optional>
     #include <tuple>
     #include <type_traits>
     #include <utility>
@@ -58,6 +61,18 @@ namespace mimicpp::detail
 
     template <typename T>
     using to_arg_storage_t = typename to_arg_storage<T>::type;
+
+    /**
+     * \brief Determines, whether a predicate-matcher denotes a plain equality-comparison against a single stored value,
+     * which hashes consistently with the given target type.
+     * \details Floating-point values are excluded on purpose, as their equality semantics are too subtle for hashing.
+     */
+    template <typename Target, typename Predicate, typename... AdditionalArgs>
+    concept hashable_equality_for = std::same_as<Predicate, std::equal_to<>>
+                                 && 1u == sizeof...(AdditionalArgs)
+                                 && (... && std::same_as<AdditionalArgs, std::remove_cvref_t<Target>>)
+                                 && (... && !std::floating_point<AdditionalArgs>)
+                                 && (... && util::hashable<AdditionalArgs>);
 }
 
 MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
@@ -139,6 +154,29 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp
                 m_AdditionalArgs);
         }
 
+        /**
+         * \brief Determines the hash of the expected value, if this matcher is a plain equality-comparison for the given
+         * target type.
+         * \tparam Target The target type.
+         * \return The hash of the stored value, or ``std::nullopt``.
+         * \details This enables expectations to be indexed by their expected argument values.
+         * A call-argument, which compares equal to the stored value, is guaranteed to have the same hash.
+         */
+        template <typename Target>
+        [[nodiscard]]
+        constexpr std::optional<std::size_t> equality_hash() const
+        {
+            if constexpr (detail::hashable_equality_for<Target, Predicate, AdditionalArgs...>)
+            {
+                using ValueT = std::remove_cvref_t<Target>;
+                return std::hash<ValueT>{}(std::get<0>(m_AdditionalArgs).arg);
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+
         [[nodiscard]]
         constexpr auto operator!() const&
             requires std::is_copy_constructible_v<Predicate>
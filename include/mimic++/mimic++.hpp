@@ -18,6 +18,7 @@
 #include "mimic++/CallConvention.hpp"
 #include "mimic++/Expectation.hpp"
 #include "mimic++/ExpectationBuilder.hpp"
+#include "mimic++/ExpectationFeed.hpp"
 #include "mimic++/Facade.hpp"
 #include "mimic++/Mock.hpp"
 #include "mimic++/ObjectWatcher.hpp"
@@ -26,6 +27,7 @@
 #include "mimic++/ScopedSequence.hpp"
 #include "mimic++/Sequence.hpp"
 #include "mimic++/String.hpp"
+#include "mimic++/Stub.hpp"
 #include "mimic++/TypeTraits.hpp"
 #include "mimic++/Utilities.hpp"
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "mimic++/TypeTraits.hpp"
 #include "mimic++/config/Config.hpp"
 #include "mimic++/matchers/Common.hpp"
 #include "mimic++/policies/ArgumentList.hpp"
@@ -19,6 +20,7 @@
     #include <cstddef>
     // ReSharper disable once CppUnusedIncludeDirective
     #include <functional> // std::invoke
+    #include <optional>
     #include <tuple>
     #include <type_traits>
     #include <utility>
@@ -90,6 +92,38 @@ namespace mimicpp::expectation_policies
         {
         }
 
+        /**
+         * \brief Determines the index-key, if this is a plain equality-requirement on the (unprojected) first argument.
+         * \tparam Signature The signature of the owning expectation.
+         * \return The hash of the expected value, or ``std::nullopt``.
+         * \see PredicateMatcher::equality_hash
+         */
+        template <typename Signature>
+        [[nodiscard]]
+        constexpr std::optional<std::size_t> index_key() const
+        {
+            using FirstArgStrategyT = mimicpp::detail::apply_args_fn<
+                mimicpp::detail::args_selector_fn<std::add_lvalue_reference_t, std::index_sequence<0u>>,
+                mimicpp::detail::arg_list_indirect_apply_fn<std::identity>>;
+
+            if constexpr (std::same_as<MatchesStrategy, FirstArgStrategyT>)
+            {
+                using ParamT = signature_param_type_t<0u, Signature>;
+                if constexpr (requires { { m_Matcher.template equality_hash<ParamT>() } -> std::convertible_to<std::optional<std::size_t>>; })
+                {
+                    return m_Matcher.template equality_hash<ParamT>();
+                }
+                else
+                {
+                    return std::nullopt;
+                }
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+
         [[nodiscard]]
         std::optional<StringT> describe() const
         {
@@ -18,6 +18,7 @@
     #include <limits>
     #include <memory>
     #include <optional>
+    #include <span>
     #include <stdexcept>
     #include <tuple>
     #include <utility>
@@ -212,6 +213,49 @@ namespace mimicpp
             update_sequence_states();
         }
 
+        [[nodiscard]]
+        constexpr std::size_t sequence_ratings(std::span<sequence::rating> const buffer) const noexcept
+        {
+            MIMICPP_ASSERT(is_applicable(), "Policy is inapplicable.");
+
+            if (sequenceCount <= buffer.size())
+            {
+                std::apply(
+                    [&](auto const&... entries) noexcept {
+                        [[maybe_unused]] std::size_t index{};
+                        (..., (buffer[index++] = sequence::rating{
+                                   .priority = *std::get<0>(entries)->priority_of(std::get<1>(entries)),
+                                   .tag = std::get<0>(entries)->tag()}));
+                    },
+                    m_Sequences);
+            }
+
+            return sequenceCount;
+        }
+
+        /**
+         * \brief Returns the position within the only attached sequence, if an exact (non-zero) amount of matches is required.
+         * \details Such a policy blocks all subsequent elements of its sequence, until it's saturated.
+         */
+        [[nodiscard]]
+        constexpr std::optional<sequence::position> strict_sequence_position() const noexcept
+        {
+            if constexpr (1u == sequenceCount)
+            {
+                if (m_Min == m_Max
+                    && 0 < m_Min)
+                {
+                    auto const& [seq, id] = std::get<0>(m_Sequences);
+
+                    return sequence::position{
+                        .tag = seq->tag(),
+                        .index = util::to_underlying(id)};
+                }
+            }
+
+            return std::nullopt;
+        }
+
         [[nodiscard]]
         reporting::control_state_t state() const
         {
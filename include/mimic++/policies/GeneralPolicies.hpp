@@ -15,6 +15,7 @@
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
     #include <iterator>
+    #include <optional>
     #include <utility>
 #endif
 
@@ -54,6 +55,12 @@ namespace mimicpp::expectation_policies
             return true;
         }
 
+        [[nodiscard]]
+        static constexpr ValueCategory expected_category() noexcept
+        {
+            return expected;
+        }
+
         template <typename Return, typename... Args>
         [[nodiscard]]
         static constexpr bool matches(const call::Info<Return, Args...>& info) noexcept
@@ -96,6 +103,12 @@ namespace mimicpp::expectation_policies
             return true;
         }
 
+        [[nodiscard]]
+        static constexpr mimicpp::Constness expected_constness() noexcept
+        {
+            return constness;
+        }
+
         template <typename Return, typename... Args>
         [[nodiscard]]
         static constexpr bool matches(const call::Info<Return, Args...>& info) noexcept
@@ -127,6 +140,59 @@ namespace mimicpp::expectation_policies
             }
         }
     };
+
+    class Fallback
+    {
+    public:
+        [[nodiscard]]
+        static constexpr bool is_satisfied() noexcept
+        {
+            return true;
+        }
+
+        [[nodiscard]]
+        static constexpr bool is_fallback() noexcept
+        {
+            return true;
+        }
+
+        template <typename Return, typename... Args>
+        [[nodiscard]]
+        static constexpr bool matches([[maybe_unused]] const call::Info<Return, Args...>& info) noexcept
+        {
+            return true;
+        }
+
+        template <typename Return, typename... Args>
+        static constexpr void consume([[maybe_unused]] const call::Info<Return, Args...>& info) noexcept
+        {
+        }
+
+        [[nodiscard]]
+        static std::nullopt_t describe() noexcept
+        {
+            return std::nullopt;
+        }
+    };
+}
+
+MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::expect
+{
+    /**
+     * \brief Marks the expectation as fallback.
+     * \ingroup EXPECTATION
+     * \return The newly created policy.
+     * \details Fallback expectations are only considered, when no regular expectation is applicable for the call;
+     * regardless of their order of construction. Among each other, fallbacks are selected by the usual rules.
+     * This makes them a good fit for broad catch-all expectations, which are set up once (e.g. in a test fixture),
+     * but shall never shadow the more specific expectations of the actual test cases.
+     * As they are kept apart, calls, which are satisfied by a regular expectation, don't even evaluate them.
+     */
+    [[nodiscard]]
+    consteval expectation_policies::Fallback as_fallback() noexcept
+    {
+        return {};
+    }
 }
 
 #endif
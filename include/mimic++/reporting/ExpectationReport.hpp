@@ -15,6 +15,7 @@
 #include "mimic++/utilities/SourceLocation.hpp"
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <cstddef>
     #include <optional>
     #include <variant>
     #include <vector>
@@ -89,6 +90,8 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::reporting
         control_state_t controlReport{};
         std::optional<StringT> finalizerDescription{};
         std::vector<std::optional<StringT>> requirementDescriptions{};
+        // Only set for expectations, which have been created from a row of an ExpectationFeed.
+        std::optional<std::size_t> rowIndex{};
 
         [[nodiscard]]
         friend bool operator==(ExpectationReport const&, ExpectationReport const&) = default;
@@ -91,8 +91,8 @@ namespace mimicpp::reporting::detail
         out = format::format_to(
             std::move(out),
             "\tOn Target `{}` used Overload `{}`\n",
-            call.target.name,
-            call.target.overloadReport.name());
+            call.target.name(),
+            call.target.overload_report().name());
 
         return out;
     }
@@ -102,6 +102,10 @@ namespace mimicpp::reporting::detail
     {
         out = format::format_to(std::move(out), "Expectation defined at ");
         out = mimicpp::print(std::move(out), expectation.from);
+        if (expectation.rowIndex)
+        {
+            out = format::format_to(std::move(out), " (row {})", *expectation.rowIndex);
+        }
         out = format::format_to(std::move(out), "\n");
 
         return out;
@@ -113,8 +117,8 @@ namespace mimicpp::reporting::detail
         out = format::format_to(
             std::move(out),
             "\tOf Target `{}` related to Overload `{}`\n",
-            expectation.target.name,
-            expectation.target.overloadReport.name());
+            expectation.target.name(),
+            expectation.target.overload_report().name());
 
         return out;
     }
@@ -12,20 +12,150 @@
 #include "mimic++/config/Config.hpp"
 #include "mimic++/reporting/TypeReport.hpp"
 
+#ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <functional>
+    #include <memory>
+    #include <mutex>
+    #include <utility>
+#endif
+
 MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::reporting
 {
     /**
      * \brief Contains the extracted mock info.
      * \ingroup REPORTING_REPORTS
+     * \details The info is stored in a shared immutable record, which is created once per mock-target.
+     * Copies just share that record, thus they are cheap and do not duplicate the (potentially long) mock-name.
+     * The mock-name may also be generated on demand, which is then done at most once per record.
+     *
+     * \note Migration: Former versions provided this report as an aggregate with the public members ``name`` and
+     * ``overloadReport``. Custom reporters must now use the ``name()`` and ``overload_report()`` accessors instead.
+     * Reports can still be created from a name and a ``TypeReport`` (e.g. ``TargetReport{name, overloadReport}``),
+     * but designated initializers are no longer supported.
      */
     class TargetReport
     {
     public:
-        StringT name;
-        TypeReport overloadReport;
+        /**
+         * \brief The signature of mock-name generators.
+         * \details Such generators receive the context, which has been provided together with the generator.
+         */
+        using name_generator_fn = StringT (*)(StringViewT);
+
+        /**
+         * \brief Creates a new record from the given info.
+         * \param name The mock-name.
+         * \param overloadReport The type-info of the targeted overload.
+         */
+        [[nodiscard]]
+        TargetReport(StringT name, TypeReport overloadReport)
+            : m_Record{
+                  std::make_shared<Record const>(
+                      std::move(name),
+                      std::move(overloadReport))}
+        {
+        }
+
+        /**
+         * \brief Creates a new record, which generates the mock-name on demand.
+         * \param nameGenerator The mock-name generator.
+         * \param nameContext The argument for the generator.
+         * \param overloadReport The type-info of the targeted overload.
+         */
+        [[nodiscard]]
+        TargetReport(name_generator_fn const nameGenerator, StringT nameContext, TypeReport overloadReport)
+            : m_Record{
+                  std::make_shared<Record const>(
+                      nameGenerator,
+                      std::move(nameContext),
+                      std::move(overloadReport))}
+        {
+            MIMICPP_ASSERT(nameGenerator, "Null name-generator is not allowed.");
+        }
 
+        /**
+         * \brief Returns the mock-name.
+         * \details Generates the name, when this is the first request.
+         * If the generator throws, the exception is swallowed and a fixed fallback name is used instead.
+         */
         [[nodiscard]]
-        friend bool operator==(const TargetReport&, const TargetReport&) = default;
+        StringT const& name() const noexcept
+        {
+            MIMICPP_ASSERT(m_Record, "Accessing a moved-from report.");
+
+            return m_Record->name();
+        }
+
+        /**
+         * \brief Returns the type-info of the targeted overload.
+         */
+        [[nodiscard]]
+        TypeReport const& overload_report() const noexcept
+        {
+            MIMICPP_ASSERT(m_Record, "Accessing a moved-from report.");
+
+            return m_Record->overloadReport;
+        }
+
+        [[nodiscard]]
+        friend bool operator==(TargetReport const& lhs, TargetReport const& rhs)
+        {
+            return lhs.m_Record == rhs.m_Record
+                || (lhs.name() == rhs.name() && lhs.overload_report() == rhs.overload_report());
+        }
+
+    private:
+        class Record
+        {
+        public:
+            TypeReport overloadReport;
+
+            [[nodiscard]]
+            explicit Record(StringT name, TypeReport report)
+                : overloadReport{std::move(report)},
+                  m_Name{std::move(name)}
+            {
+            }
+
+            [[nodiscard]]
+            explicit Record(name_generator_fn const generator, StringT context, TypeReport report)
+                : overloadReport{std::move(report)},
+                  m_NameGenerator{generator},
+                  m_NameContext{std::move(context)}
+            {
+            }
+
+            [[nodiscard]]
+            StringT const& name() const noexcept
+            {
+                if (m_NameGenerator)
+                {
+                    std::call_once(
+                        m_NameFlag,
+                        [this]() noexcept {
+                            try
+                            {
+                                m_Name = std::invoke(m_NameGenerator, m_NameContext);
+                            }
+                            catch (...)
+                            {
+                                // The fallback fits into the small-string buffer, thus it can not throw.
+                                m_Name = "unnamed-mock";
+                            }
+                        });
+                }
+
+                return m_Name;
+            }
+
+        private:
+            name_generator_fn m_NameGenerator{};
+            StringT m_NameContext{};
+            mutable std::once_flag m_NameFlag{};
+            mutable StringT m_Name{};
+        };
+
+        std::shared_ptr<Record const> m_Record;
     };
 }
 
@@ -0,0 +1,145 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_UTILITIES_AFFINE_MUTEX_HPP
+#define MIMICPP_UTILITIES_AFFINE_MUTEX_HPP
+
+#pragma once
+
+#include "mimic++/Fwd.hpp"
+#include "mimic++/config/Config.hpp"
+#include "mimic++/reporting/GlobalReporter.hpp"
+
+#ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <thread>
+#endif
+
+namespace mimicpp::util::detail
+{
+    /**
+     * \brief Mutex adapter, which skips the synchronization when it's bound to a single thread.
+     * \tparam Mutex The underlying mutex-type.
+     * \details When constructed with ``ThreadAffinity::owner``, the constructing thread becomes the owner.
+     * All locking operations are then no-ops, which just verify that they are performed by the owner.
+     * Unless ``NDEBUG`` is defined, each violation is reported as an error via the installed reporter.
+     * Otherwise, all operations are forwarded to the underlying mutex.
+     * \note The affinity is a runtime property, because it's chosen per mock via ``MockSettings``
+     * and must therefore not alter the type of the mock or its expectation-collection.
+     * Confined mutexes thus still pay a single, perfectly predictable branch per operation and carry the (untouched)
+     * underlying mutex.
+     * For the same reason, the reference-counts of shared objects (e.g. the sequences of ``ControlPolicy``) stay atomic:
+     * Sequences may be shared between mocks with different affinities and outlive the thread, which created them.
+     */
+    template <typename Mutex>
+    class AffineMutex
+    {
+    public:
+        ~AffineMutex() = default;
+
+        [[nodiscard]]
+        explicit AffineMutex(ThreadAffinity const affinity = ThreadAffinity::any) noexcept
+            : m_IsConfined{ThreadAffinity::owner == affinity},
+              m_Owner{std::this_thread::get_id()}
+        {
+        }
+
+        AffineMutex(AffineMutex const&) = delete;
+        AffineMutex& operator=(AffineMutex const&) = delete;
+        AffineMutex(AffineMutex&&) = delete;
+        AffineMutex& operator=(AffineMutex&&) = delete;
+
+        void lock()
+        {
+            if (m_IsConfined)
+            {
+                assert_owner();
+            }
+            else
+            {
+                m_Mutex.lock();
+            }
+        }
+
+        [[nodiscard]]
+        bool try_lock()
+        {
+            if (m_IsConfined)
+            {
+                assert_owner();
+
+                return true;
+            }
+
+            return m_Mutex.try_lock();
+        }
+
+        void unlock()
+        {
+            if (!m_IsConfined)
+            {
+                m_Mutex.unlock();
+            }
+        }
+
+        void lock_shared()
+            requires requires(Mutex& mutex) { mutex.lock_shared(); }
+        {
+            if (m_IsConfined)
+            {
+                assert_owner();
+            }
+            else
+            {
+                m_Mutex.lock_shared();
+            }
+        }
+
+        [[nodiscard]]
+        bool try_lock_shared()
+            requires requires(Mutex& mutex) { mutex.try_lock_shared(); }
+        {
+            if (m_IsConfined)
+            {
+                assert_owner();
+
+                return true;
+            }
+
+            return m_Mutex.try_lock_shared();
+        }
+
+        void unlock_shared()
+            requires requires(Mutex& mutex) { mutex.unlock_shared(); }
+        {
+            if (!m_IsConfined)
+            {
+                m_Mutex.unlock_shared();
+            }
+        }
+
+        [[nodiscard]]
+        bool is_confined() const noexcept
+        {
+            return m_IsConfined;
+        }
+
+    private:
+        Mutex m_Mutex{};
+        bool m_IsConfined;
+        std::thread::id m_Owner;
+
+        void assert_owner() const
+        {
+#ifndef NDEBUG
+            if (std::this_thread::get_id() != m_Owner) [[unlikely]]
+            {
+                reporting::detail::report_error("Thread-confined object used from a foreign thread.");
+            }
+#endif
+        }
+    };
+}
+
+#endif
@@ -12,6 +12,9 @@
 
 #ifndef MIMICPP_DETAIL_IS_MODULE
     #include <concepts>
+    #include <cstddef>
+    #include <functional>
+    #include <type_traits>
     #include <utility>
 #endif
 
@@ -83,6 +86,17 @@ MIMICPP_DETAIL_MODULE_EXPORT namespace mimicpp::util
             { u != t } -> boolean_testable;
         };
 
+    /**
+     * \brief Determines, whether `T` has an enabled `std::hash` specialization.
+     * \see https://en.cppreference.com/w/cpp/utility/hash
+     */
+    template <typename T>
+    concept hashable =
+        std::is_default_constructible_v<std::hash<T>>
+        && requires(std::hash<T> const& hash, T const& value) {
+               { hash(value) } -> std::convertible_to<std::size_t>;
+           };
+
     /**
      * \}
      */
@@ -0,0 +1,250 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef MIMICPP_UTILITIES_PARALLEL_FOR_HPP
+#define MIMICPP_UTILITIES_PARALLEL_FOR_HPP
+
+#pragma once
+
+#include "mimic++/config/Config.hpp"
+
+#ifndef MIMICPP_DETAIL_IS_MODULE
+    #include <algorithm>
+    #include <atomic>
+    #include <concepts>
+    #include <condition_variable>
+    #include <cstddef>
+    #include <deque>
+    #include <functional>
+    #include <memory>
+    #include <mutex>
+    #include <new>
+    #include <system_error>
+    #include <thread>
+    #include <vector>
+#endif
+
+namespace mimicpp::util::detail
+{
+    /**
+     * \brief A pool of persistent threads, which help out with the execution of jobs.
+     * \details The threads are spawned on demand and then sleep, until new work is offered.
+     * A job is offered to a limited amount of helpers, but always executed by the offering thread, too. After that, all
+     * offers, which haven't been picked up yet, are withdrawn and just the actually participating helpers are awaited.
+     * Thus, a job never waits for busy threads, which makes concurrent and nested jobs deadlock-free.
+     */
+    class WorkerPool
+    {
+    public:
+        /**
+         * \brief A type-erased job, which may be executed by multiple threads at once.
+         * \attention The job must not outlive the referenced function.
+         */
+        class Job
+        {
+        public:
+            template <std::invocable Fn>
+            [[nodiscard]]
+            explicit Job(Fn& fn) noexcept
+                : m_Context{std::addressof(fn)},
+                  m_Invoke{[](void* const context) noexcept { std::invoke(*static_cast<Fn*>(context)); }}
+            {
+            }
+
+            Job(Job const&) = delete;
+            Job& operator=(Job const&) = delete;
+            Job(Job&&) = delete;
+            Job& operator=(Job&&) = delete;
+
+        private:
+            friend WorkerPool;
+
+            void* m_Context;
+            void (*m_Invoke)(void*) noexcept;
+            // The amount of helpers, which are currently executing this job. Guarded by the mutex of the pool.
+            std::size_t m_Participants{};
+
+            void execute() const noexcept
+            {
+                std::invoke(m_Invoke, m_Context);
+            }
+        };
+
+        ~WorkerPool() noexcept
+        {
+            {
+                std::scoped_lock const lock{m_Mutex};
+                m_IsStopping = true;
+            }
+            m_WorkAvailable.notify_all();
+
+            for (std::thread& thread : m_Threads)
+            {
+                thread.join();
+            }
+        }
+
+        [[nodiscard]]
+        WorkerPool() = default;
+
+        WorkerPool(WorkerPool const&) = delete;
+        WorkerPool& operator=(WorkerPool const&) = delete;
+        WorkerPool(WorkerPool&&) = delete;
+        WorkerPool& operator=(WorkerPool&&) = delete;
+
+        /**
+         * \brief Executes the job on the calling thread, while it's offered to at most ``helpers`` threads of this pool.
+         * \param job The job, which must not throw.
+         * \param helpers The maximal amount of additional threads.
+         * \details Returns after all participating threads have finished the job.
+         * If no (or less) threads can be spawned, the job is executed by the already participating ones.
+         */
+        void run(Job& job, std::size_t const helpers)
+        {
+            offer(job, helpers);
+            job.execute();
+            withdraw(job);
+        }
+
+    private:
+        std::mutex m_Mutex{};
+        std::condition_variable m_WorkAvailable{};
+        std::condition_variable m_WorkFinished{};
+        std::deque<Job*> m_Offers{};
+        std::vector<std::thread> m_Threads{};
+        bool m_IsStopping{false};
+
+        void offer(Job& job, std::size_t const helpers)
+        {
+            std::size_t offered{0u};
+            {
+                std::scoped_lock const lock{m_Mutex};
+                try
+                {
+                    m_Threads.reserve(helpers);
+                    while (m_Threads.size() < helpers)
+                    {
+                        m_Threads.emplace_back([this] { serve(); });
+                    }
+                }
+                catch (std::system_error const&)
+                {
+                    // Running out of threads is not an error; the work is just distributed over fewer threads.
+                }
+                catch (std::bad_alloc const&)
+                {
+                }
+
+                try
+                {
+                    for (; offered < std::min(helpers, m_Threads.size()); ++offered)
+                    {
+                        m_Offers.emplace_back(&job);
+                    }
+                }
+                catch (std::bad_alloc const&)
+                {
+                    // Same as above; the job is just offered to fewer threads.
+                }
+            }
+
+            if (1u == offered)
+            {
+                m_WorkAvailable.notify_one();
+            }
+            else if (1u < offered)
+            {
+                m_WorkAvailable.notify_all();
+            }
+        }
+
+        void withdraw(Job& job)
+        {
+            std::unique_lock lock{m_Mutex};
+            std::erase(m_Offers, &job);
+            m_WorkFinished.wait(lock, [&] { return 0u == job.m_Participants; });
+        }
+
+        void serve()
+        {
+            std::unique_lock lock{m_Mutex};
+            for (;;)
+            {
+                m_WorkAvailable.wait(lock, [&] { return m_IsStopping || !m_Offers.empty(); });
+                if (m_IsStopping)
+                {
+                    return;
+                }
+
+                Job& job = *m_Offers.front();
+                m_Offers.pop_front();
+                ++job.m_Participants;
+
+                lock.unlock();
+                job.execute();
+                lock.lock();
+
+                if (0u == --job.m_Participants)
+                {
+                    m_WorkFinished.notify_all();
+                }
+            }
+        }
+    };
+
+    /**
+     * \brief The process-wide pool, which is shared by all parallel evaluations.
+     */
+    [[nodiscard]]
+    inline WorkerPool& worker_pool()
+    {
+        static WorkerPool pool{};
+
+        return pool;
+    }
+
+    /**
+     * \brief Invokes the given function for each index of ``[0, count)``, distributed over multiple threads.
+     * \tparam Fn The function type.
+     * \param count The amount of indices.
+     * \param workers The maximal amount of participating threads (including the calling one).
+     * \param fn The function, which must not throw.
+     * \details The indices are split into chunks, which are claimed in ascending order. The calling thread participates in
+     * the work, thus at most ``workers - 1`` threads of the ``worker_pool`` help out. If a thread can not be spawned, the
+     * remaining chunks are processed by the already participating ones. This function returns after all indices have been
+     * processed.
+     */
+    template <std::invocable<std::size_t> Fn>
+    void parallel_for(std::size_t const count, std::size_t const workers, Fn fn)
+    {
+        std::size_t const chunkSize = std::max<std::size_t>(1u, count / (8u * std::max<std::size_t>(1u, workers)));
+        std::atomic_size_t nextChunk{0u};
+        auto work = [&]() noexcept {
+            for (std::size_t begin = nextChunk.fetch_add(chunkSize, std::memory_order_relaxed);
+                 begin < count;
+                 begin = nextChunk.fetch_add(chunkSize, std::memory_order_relaxed))
+            {
+                std::size_t const end = std::min(count, begin + chunkSize);
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    std::invoke(fn, i);
+                }
+            }
+        };
+
+        if (1u < workers && chunkSize < count)
+        {
+            std::size_t const helpers = std::min(workers, (count + chunkSize - 1u) / chunkSize) - 1u;
+            WorkerPool::Job job{work};
+            worker_pool().run(job, helpers);
+        }
+        else
+        {
+            work();
+        }
+    }
+}
+
+#endif
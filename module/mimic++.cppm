@@ -11,8 +11,10 @@ module;
 #include <any>
 #include <array>
 #include <atomic>
+#include <bitset>
 #include <cmath>
 #include <concepts>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdlib>
 #include <deque>
@@ -23,15 +25,20 @@ module;
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <new>
 #include <optional>
 #include <ranges>
+#include <shared_mutex>
 #include <source_location>
 #include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
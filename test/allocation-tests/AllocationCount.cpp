@@ -0,0 +1,226 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <utility>
+
+// The global allocation functions are replaced for the whole test executable, which is therefore kept separate.
+// Allocations are just counted, while an AllocationCounter is alive on the current thread.
+namespace
+{
+    thread_local bool isCounting{false};
+    thread_local std::size_t allocationCount{};
+
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter(AllocationCounter const&) = delete;
+        AllocationCounter& operator=(AllocationCounter const&) = delete;
+
+        [[nodiscard]]
+        AllocationCounter() noexcept
+        {
+            allocationCount = 0u;
+            isCounting = true;
+        }
+
+        ~AllocationCounter() noexcept
+        {
+            isCounting = false;
+        }
+
+        [[nodiscard]]
+        std::size_t count() const noexcept
+        {
+            return allocationCount;
+        }
+    };
+
+    [[nodiscard]]
+    void* allocate(std::size_t const size) noexcept
+    {
+        if (isCounting)
+        {
+            ++allocationCount;
+        }
+
+        return std::malloc(0u == size ? 1u : size);
+    }
+}
+
+void* operator new(std::size_t const size)
+{
+    if (void* const ptr = allocate(size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t const size)
+{
+    if (void* const ptr = allocate(size))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t const size, [[maybe_unused]] std::nothrow_t const& tag) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t const size, [[maybe_unused]] std::nothrow_t const& tag) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* const ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, [[maybe_unused]] std::size_t const size) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr, [[maybe_unused]] std::size_t const size) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, [[maybe_unused]] std::nothrow_t const& tag) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* const ptr, [[maybe_unused]] std::nothrow_t const& tag) noexcept
+{
+    std::free(ptr);
+}
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "Creating an expectation requires at most a single allocation.",
+    "[expectation][allocation]")
+{
+    Mock<int(int)> mock{};
+
+    // Warms up the internal storage of the mock.
+    {
+        ScopedExpectation const expectation = mock.expect_call(42)
+                                          and finally::returns(1337);
+        REQUIRE(1337 == mock(42));
+    }
+
+    std::optional<ScopedExpectation> expectation{};
+
+    SECTION("When the expectation is indexable.")
+    {
+        {
+            AllocationCounter const counter{};
+            expectation.emplace(
+                mock.expect_call(42)
+                and finally::returns(1337));
+            CHECK(counter.count() <= 1u);
+        }
+
+        REQUIRE(1337 == mock(42));
+    }
+
+    SECTION("When the expectation is not indexable.")
+    {
+        {
+            AllocationCounter const counter{};
+            expectation.emplace(
+                mock.expect_call(matches::_)
+                and expect::any_times()
+                and finally::returns(1337));
+            CHECK(counter.count() <= 1u);
+        }
+
+        REQUIRE(1337 == mock(42));
+    }
+}
+
+TEST_CASE(
+    "Moving a ScopedExpectation does not allocate.",
+    "[expectation][allocation]")
+{
+    Mock<void()> mock{};
+
+    ScopedExpectation source = mock.expect_call();
+    std::optional<ScopedExpectation> target{};
+
+    {
+        AllocationCounter const counter{};
+        target.emplace(std::move(source));
+        CHECK(0u == counter.count());
+    }
+
+    mock();
+    REQUIRE(target->is_satisfied());
+}
+
+TEST_CASE(
+    "ScopedExpectationBatch allocates exclusively from the memory-resource of the mock.",
+    "[expectation][allocation]")
+{
+    struct Row
+    {
+        int arg;
+        int result;
+    };
+
+    std::array<Row, 3u> const rows{
+        {{1, 10}, {2, 20}, {3, 30}}
+    };
+
+    std::array<std::byte, 16u * 1024u> buffer{};
+    std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    Mock<int(int)> mock{
+        MockSettings{.memoryResource = &resource}};
+
+    {
+        std::optional<ScopedExpectationBatch> expectations{};
+        {
+            AllocationCounter const counter{};
+            expectations.emplace(
+                rows,
+                [&](Row const& row) {
+                    return mock.expect_call(row.arg)
+                       and finally::returns(row.result);
+                });
+            CHECK(0u == counter.count());
+        }
+
+        REQUIRE(10 == mock(1));
+        REQUIRE(20 == mock(2));
+        REQUIRE(30 == mock(3));
+
+        AllocationCounter const counter{};
+        expectations.reset();
+        CHECK(0u == counter.count());
+    }
+}
@@ -0,0 +1,58 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "The expectation scan of concurrent calls scales with the amount of threads.",
+    "[!benchmark][expectation][thread-safety]")
+{
+    // Each thread performs the same amount of calls, thus constant timings mean linear throughput scaling.
+    constexpr std::size_t callsPerThread{1'000u};
+    constexpr std::size_t youngerCount{50u};
+    std::size_t const threadCount = GENERATE(1u, 2u, 4u, 8u, 16u, 32u);
+    CallConcurrency const concurrency = GENERATE(CallConcurrency::serialized, CallConcurrency::optimistic);
+
+    Mock<void(int)> mock{
+        MockSettings{.callConcurrency = concurrency}};
+    ScopedExpectation const expectation = mock.expect_call(42) and expect::any_times();
+
+    // These are evaluated first, but never match.
+    std::vector<ScopedExpectation> youngerExpectations{};
+    youngerExpectations.reserve(youngerCount);
+    for (std::size_t i{}; i < youngerCount; ++i)
+    {
+        youngerExpectations.emplace_back(mock.expect_call(matches::lt(0)) and expect::any_times());
+    }
+
+    BENCHMARK(
+        std::to_string(threadCount) + " threads with " + std::to_string(callsPerThread) + " calls each"
+        + (CallConcurrency::optimistic == concurrency ? " (optimistic)" : " (serialized)"))
+    {
+        std::vector<std::thread> threads{};
+        threads.reserve(threadCount);
+        for (std::size_t t{}; t < threadCount; ++t)
+        {
+            threads.emplace_back([&] {
+                for (std::size_t i{}; i < callsPerThread; ++i)
+                {
+                    mock(42);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    };
+}
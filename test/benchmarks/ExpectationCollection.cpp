@@ -0,0 +1,189 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/ExpectationFeed.hpp"
+#include "mimic++/Mock.hpp"
+#include "mimic++/ScopedSequence.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "The dispatch time does not depend on the amount of older expectations.",
+    "[!benchmark][expectation]")
+{
+    std::size_t const olderCount = GENERATE(0u, 10u, 100u, 1'000u, 10'000u);
+
+    Mock<void(int)> mock{};
+    std::vector<ScopedExpectation> olderExpectations{};
+    olderExpectations.reserve(olderCount);
+    for (std::size_t i{}; i < olderCount; ++i)
+    {
+        olderExpectations.emplace_back(mock.expect_call(matches::_) and expect::any_times());
+    }
+
+    ScopedExpectation const expectation = mock.expect_call(42) and expect::any_times();
+
+    BENCHMARK("handle_call with " + std::to_string(olderCount) + " older expectations")
+    {
+        mock(42);
+    };
+}
+
+TEST_CASE(
+    "The dispatch time does not depend on the amount of indexed expectations.",
+    "[!benchmark][expectation]")
+{
+    int const expectationCount = GENERATE(10, 100, 1'000, 10'000);
+
+    Mock<void(int)> mock{};
+    std::vector<ScopedExpectation> expectations{};
+    expectations.reserve(static_cast<std::size_t>(expectationCount));
+    for (int i{}; i < expectationCount; ++i)
+    {
+        expectations.emplace_back(mock.expect_call(i) and expect::any_times());
+    }
+
+    // The oldest one is selected, thus a linear scan would have to visit all others.
+    BENCHMARK("handle_call with " + std::to_string(expectationCount) + " indexed expectations")
+    {
+        mock(0);
+    };
+}
+
+TEST_CASE(
+    "The time to create and destroy n expectations grows linearly.",
+    "[!benchmark][expectation]")
+{
+    std::size_t const expectationCount = GENERATE(100u, 1'000u, 10'000u);
+
+    Mock<void(int)> mock{};
+
+    BENCHMARK("push and remove " + std::to_string(expectationCount) + " expectations")
+    {
+        std::vector<ScopedExpectation> expectations{};
+        expectations.reserve(expectationCount);
+        for (std::size_t i{}; i < expectationCount; ++i)
+        {
+            expectations.emplace_back(mock.expect_call(matches::_) and expect::any_times());
+        }
+
+        // destroys the oldest expectation first
+        expectations.clear();
+    };
+}
+
+TEST_CASE(
+    "Registering expectations in bulk is cheaper than one by one.",
+    "[!benchmark][expectation]")
+{
+    int const expectationCount = GENERATE(100, 1'000, 10'000);
+
+    std::vector<int> rows(static_cast<std::size_t>(expectationCount));
+    std::iota(rows.begin(), rows.end(), 0);
+
+    Mock<void(int)> mock{};
+
+    BENCHMARK("push and remove " + std::to_string(expectationCount) + " expectations one by one")
+    {
+        std::vector<ScopedExpectation> expectations{};
+        expectations.reserve(rows.size());
+        for (int const row : rows)
+        {
+            expectations.emplace_back(mock.expect_call(row) and expect::any_times());
+        }
+
+        expectations.clear();
+    };
+
+    BENCHMARK("push and remove " + std::to_string(expectationCount) + " expectations as batch")
+    {
+        ScopedExpectationBatch const expectations{
+            rows,
+            [&](int const row) { return mock.expect_call(row) and expect::any_times(); }};
+    };
+}
+
+TEST_CASE(
+    "The time to replay n strictly sequenced steps grows linearly.",
+    "[!benchmark][expectation][sequence]")
+{
+    int const stepCount = GENERATE(100, 1'000, 10'000, 100'000);
+
+    Mock<void(int)> mock{};
+
+    BENCHMARK("replay " + std::to_string(stepCount) + " sequenced steps")
+    {
+        ScopedSequence sequence{};
+        for (int i{}; i < stepCount; ++i)
+        {
+            sequence += mock.expect_call(matches::_);
+        }
+
+        for (int i{}; i < stepCount; ++i)
+        {
+            mock(i);
+        }
+    };
+}
+
+TEST_CASE(
+    "Replaying n steps from a feed does not materialize them upfront.",
+    "[!benchmark][expectation]")
+{
+    int const stepCount = GENERATE(100, 1'000, 10'000, 100'000);
+
+    Mock<void(int)> mock{};
+
+    BENCHMARK("replay " + std::to_string(stepCount) + " steps from a feed")
+    {
+        ScopedExpectation const expectation = ExpectationFeed{
+            std::views::iota(0, stepCount),
+            [&](int const step) { return mock.expect_call(step); }};
+
+        for (int i{}; i < stepCount; ++i)
+        {
+            mock(i);
+        }
+    };
+}
+
+TEST_CASE(
+    "The parallel evaluation pays off from the recommended threshold on.",
+    "[!benchmark][expectation][thread-safety]")
+{
+    // Brackets the threshold, which is recommended by settings::parallel_evaluation_threshold.
+    std::size_t const candidateCount = GENERATE(256u, 1'024u, 4'096u, 16'384u, 65'536u);
+
+    Mock<void(int)> mock{};
+    ScopedExpectation const expectation = mock.expect_call(matches::ge(0)) and expect::any_times();
+    // The unindexed winner is never cached, as long as an indexed expectation exists. Thus, each call visits all candidates.
+    ScopedExpectation const indexed = mock.expect_call(-1) and expect::any_times();
+
+    std::vector<ScopedExpectation> youngerExpectations{};
+    youngerExpectations.reserve(candidateCount);
+    for (std::size_t i{}; i < candidateCount; ++i)
+    {
+        youngerExpectations.emplace_back(mock.expect_call(matches::lt(0)) and expect::any_times());
+    }
+
+    BENCHMARK("sequential evaluation of " + std::to_string(candidateCount) + " candidates")
+    {
+        mock(42);
+    };
+
+    settings::parallel_evaluation_threshold() = 0u;
+    BENCHMARK("parallel evaluation of " + std::to_string(candidateCount) + " candidates")
+    {
+        mock(42);
+    };
+    settings::parallel_evaluation_threshold() = std::numeric_limits<std::size_t>::max();
+}
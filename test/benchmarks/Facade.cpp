@@ -0,0 +1,76 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Facade.hpp"
+#include "mimic++/Mock.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+using namespace mimicpp;
+
+namespace
+{
+    struct ManyMembers
+    {
+        MIMICPP_MAKE_MEMBER_MOCK(fn0, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn1, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn2, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn3, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn4, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn5, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn6, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn7, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn8, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn9, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn10, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn11, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn12, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn13, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn14, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn15, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn16, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn17, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn18, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn19, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn20, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn21, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn22, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn23, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn24, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn25, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn26, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn27, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn28, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn29, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn30, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn31, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn32, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn33, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn34, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn35, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn36, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn37, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn38, int, (int));
+        MIMICPP_MAKE_MEMBER_MOCK(fn39, int, (int));
+    };
+}
+
+TEST_CASE(
+    "Constructing an object with many member-mocks is cheap.",
+    "[!benchmark][facade]")
+{
+    BENCHMARK("construct object with 40 member-mocks")
+    {
+        return ManyMembers{};
+    };
+
+    BENCHMARK("construct object with 40 member-mocks and set up a single expectation")
+    {
+        ManyMembers object{};
+        ScopedExpectation const expectation = object.fn0_.expect_call(42)
+                                          and finally::returns(1337);
+
+        return object.fn0(42);
+    };
+}
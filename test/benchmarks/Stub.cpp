@@ -0,0 +1,43 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/Stub.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "Stubs dispatch calls without the expectation overhead of Mocks.",
+    "[!benchmark][stub]")
+{
+    Mock<int(int)> mock{};
+    ScopedExpectation const expectation = mock.expect_call(matches::_)
+                                      and expect::any_times()
+                                      and finally::returns(42);
+
+    Stub<int(int)> stub{};
+    stub.bind(finally::returns(42));
+
+    BENCHMARK("Mock<int(int)>::operator()")
+    {
+        return mock(1337);
+    };
+
+    BENCHMARK("Stub<int(int)>::operator()")
+    {
+        return stub(1337);
+    };
+
+    BENCHMARK("construct Mock<int(int)>")
+    {
+        return Mock<int(int)>{};
+    };
+
+    BENCHMARK("construct Stub<int(int)>")
+    {
+        return Stub<int(int)>{};
+    };
+}
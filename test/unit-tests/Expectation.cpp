@@ -7,6 +7,7 @@
 #include "mimic++/ExpectationBuilder.hpp"
 #include "mimic++/Printing.hpp"
 #include "mimic++/policies/FinalizerPolicies.hpp"
+#include "mimic++/policies/GeneralPolicies.hpp"
 
 #include "SuppressionMacros.hpp"
 #include "TestReporter.hpp"
@@ -15,6 +16,7 @@
 #include <functional>
 #include <optional>
 #include <ranges>
+#include <span>
 
 using namespace mimicpp;
 
@@ -39,6 +41,56 @@ namespace
         MAKE_CONST_MOCK0(from, util::SourceLocation const&(), noexcept override);
         MAKE_CONST_MOCK0(mock_name, StringT const&(), noexcept override);
         MAKE_CONST_MOCK1(matches, RequirementOutcomes(const CallInfoT&), override);
+        MAKE_CONST_MOCK1(is_matching, bool(const CallInfoT&), override);
+        MAKE_CONST_MOCK1(sequence_ratings, std::size_t(std::span<sequence::rating>), override);
+
+        std::size_t sequenceCount{};
+
+        [[nodiscard]]
+        std::size_t sequence_count() const noexcept override
+        {
+            return sequenceCount;
+        }
+
+        bool isSaturated{};
+
+        [[nodiscard]]
+        bool is_saturated() const noexcept override
+        {
+            return isSaturated;
+        }
+
+        std::optional<sequence::position> sequencePosition{};
+
+        [[nodiscard]]
+        std::optional<sequence::position> strict_sequence_position() const noexcept override
+        {
+            return sequencePosition;
+        }
+
+        std::optional<std::size_t> indexKey{};
+
+        [[nodiscard]]
+        std::optional<std::size_t> index_key() const override
+        {
+            return indexKey;
+        }
+
+        std::tuple<Constness, ValueCategory> qualifications{Constness::any, ValueCategory::any};
+
+        [[nodiscard]]
+        std::tuple<Constness, ValueCategory> qualification() const noexcept override
+        {
+            return qualifications;
+        }
+
+        bool isFallback{};
+
+        [[nodiscard]]
+        bool is_fallback() const noexcept override
+        {
+            return isFallback;
+        }
         MAKE_MOCK1(consume, void(const CallInfoT&), override);
         MAKE_MOCK1(finalize_call, void(const CallInfoT&), override);
     };
@@ -48,8 +100,8 @@ namespace
     reporting::TargetReport make_common_target_report()
     {
         return reporting::TargetReport{
-            .name = "Mock-Name",
-            .overloadReport = reporting::TypeReport::make<Signature>()};
+            "Mock-Name",
+            reporting::TypeReport::make<Signature>()};
     }
 }
 
@@ -62,49 +114,790 @@ TEST_CASE(
     StorageT storage{};
     auto expectation = std::make_shared<ExpectationMock>();
 
-    REQUIRE_NOTHROW(storage.push(expectation));
+    StorageT::Handle handle{};
+    REQUIRE_NOTHROW(handle = storage.push(expectation));
+    REQUIRE(StorageT::Handle{} != handle);
+
+    ScopedReporter reporter{};
+    SECTION("When expectation is satisfied, nothing is reported.")
+    {
+        REQUIRE_CALL(*expectation, is_satisfied())
+            .RETURN(true);
+        REQUIRE_NOTHROW(storage.remove(handle));
+        REQUIRE_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::IsEmpty());
+    }
+
+    SECTION("When expectation is unfulfilled, it is reported.")
+    {
+        reporting::ExpectationReport const expReport{
+            .target = make_common_target_report<void()>(),
+            .controlReport = commonUnsatisfiedState};
+
+        REQUIRE_CALL(*expectation, is_satisfied())
+            .RETURN(false);
+        REQUIRE_CALL(*expectation, report())
+            .RETURN(expReport);
+        REQUIRE_NOTHROW(storage.remove(handle));
+        REQUIRE_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::SizeIs(1));
+        REQUIRE(expReport == reporter.unfulfilled_expectations().at(0));
+    }
+}
+
+namespace
+{
+    inline reporting::RequirementOutcomes const commonMatchingOutcome{
+        .outcomes = {true}};
+
+    inline reporting::RequirementOutcomes const commonNonMatchingOutcome{
+        .outcomes = {true, false}
+    };
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection keeps the reverse order of construction, when expectations are removed.",
+    "[expectation]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(4);
+    std::vector<StorageT::Handle> handles{};
+    for (auto& exp : expectations | std::views::take(3))
+    {
+        exp = std::make_shared<ExpectationMock>();
+        handles.emplace_back(storage.push(exp));
+    }
+
+    REQUIRE_CALL(*expectations[1], is_satisfied())
+        .RETURN(true);
+    storage.remove(handles[1]);
+
+    // reuses the slot of the removed one
+    expectations[3] = std::make_shared<ExpectationMock>();
+    handles.emplace_back(storage.push(expectations[3]));
+    REQUIRE(handles[1] != handles[3]);
+
+    CallInfoT const call{
+        .args = {},
+        .fromCategory = ValueCategory::any,
+        .fromConstness = Constness::any};
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
+
+    trompeloeil::sequence sequence{};
+    REQUIRE_CALL(*expectations[3], is_matching(_))
+        .IN_SEQUENCE(sequence)
+        .RETURN(false);
+    REQUIRE_CALL(*expectations[2], is_matching(_))
+        .IN_SEQUENCE(sequence)
+        .RETURN(false);
+    REQUIRE_CALL(*expectations[0], is_matching(_))
+        .IN_SEQUENCE(sequence)
+        .RETURN(true);
+    REQUIRE_CALL(*expectations[0], is_applicable())
+        .RETURN(true);
+    REQUIRE_CALL(*expectations[0], report())
+        .RETURN(expectationReport);
+    REQUIRE_CALL(*expectations[0], consume(_));
+    REQUIRE_CALL(*expectations[0], finalize_call(_));
+
+    REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection queries its expectations, whether they match the call, in reverse order of construction.",
+    "[expectation]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(4);
+    for (auto& exp : expectations)
+    {
+        exp = std::make_shared<ExpectationMock>();
+        storage.push(exp);
+    }
+
+    CallInfoT const call{
+        .args = {},
+        .fromCategory = ValueCategory::any,
+        .fromConstness = Constness::any};
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
+
+    SECTION("If a full match is found, older expectations are not queried.")
+    {
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[3], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], consume(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence);
+        REQUIRE_CALL(*expectations[1], finalize_call(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence);
+
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+        REQUIRE_THAT(
+            reporter.no_match_reports(),
+            Catch::Matchers::IsEmpty());
+        REQUIRE_THAT(
+            reporter.inapplicable_match_reports(),
+            Catch::Matchers::IsEmpty());
+        REQUIRE_THAT(
+            reporter.full_match_reports(),
+            Catch::Matchers::SizeIs(1));
+    }
+
+    SECTION("If at least one matches but is inapplicable.")
+    {
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[3], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[3], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+        REQUIRE_CALL(*expectations[2], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonMatchingOutcome);
+        REQUIRE_CALL(*expectations[1], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+        REQUIRE_CALL(*expectations[0], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+
+        REQUIRE_CALL(*expectations[2], is_applicable())
+            .TIMES(2)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], report())
+            .RETURN(expectationReport);
+
+        REQUIRE_THROWS_AS(
+            storage.handle_call(make_common_target_report<void()>(), call),
+            NonApplicableMatchError);
+        REQUIRE_THAT(
+            reporter.no_match_reports(),
+            Catch::Matchers::IsEmpty());
+        REQUIRE_THAT(
+            reporter.inapplicable_match_reports(),
+            Catch::Matchers::SizeIs(1u));
+        REQUIRE_THAT(
+            reporter.full_match_reports(),
+            Catch::Matchers::IsEmpty());
+    }
+
+    SECTION("If none matches.")
+    {
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[3], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[3], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+        REQUIRE_CALL(*expectations[2], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+        REQUIRE_CALL(*expectations[1], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+        REQUIRE_CALL(*expectations[0], matches(_))
+            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .IN_SEQUENCE(sequence)
+            .RETURN(commonNonMatchingOutcome);
+
+        REQUIRE_CALL(*expectations[3], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[2], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+
+        REQUIRE_THROWS_AS(
+            storage.handle_call(make_common_target_report<void()>(), call),
+            NoMatchError);
+        REQUIRE_THAT(
+            reporter.no_match_reports(),
+            Catch::Matchers::SizeIs(1u));
+        REQUIRE_THAT(
+            std::get<1>(reporter.no_match_reports().front()),
+            Catch::Matchers::SizeIs(4u));
+        REQUIRE_THAT(
+            reporter.inapplicable_match_reports(),
+            Catch::Matchers::IsEmpty());
+        REQUIRE_THAT(
+            reporter.full_match_reports(),
+            Catch::Matchers::IsEmpty());
+    }
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection retires saturated expectations.",
+    "[expectation]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(2);
+    std::vector<StorageT::Handle> handles{};
+    for (auto& exp : expectations)
+    {
+        exp = std::make_shared<ExpectationMock>();
+        handles.emplace_back(storage.push(exp));
+    }
+
+    CallInfoT const call{
+        .args = {},
+        .fromCategory = ValueCategory::any,
+        .fromConstness = Constness::any};
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
+
+    {
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_))
+            .LR_SIDE_EFFECT(expectations[1]->isSaturated = true);
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("Retired expectations are not queried, when another match exists.")
+    {
+        FORBID_CALL(*expectations[1], is_matching(_));
+
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+
+        REQUIRE_THAT(
+            reporter.full_match_reports(),
+            Catch::Matchers::SizeIs(2u));
+    }
+
+    SECTION("Retired expectations still contribute to the inapplicable-match diagnostics.")
+    {
+        FORBID_CALL(*expectations[1], is_matching(_));
+
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], matches(_))
+            .RETURN(commonMatchingOutcome);
+        REQUIRE_CALL(*expectations[0], matches(_))
+            .RETURN(commonNonMatchingOutcome);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+
+        REQUIRE_THROWS_AS(
+            storage.handle_call(make_common_target_report<void()>(), call),
+            NonApplicableMatchError);
+        REQUIRE_THAT(
+            reporter.inapplicable_match_reports(),
+            Catch::Matchers::SizeIs(1u));
+    }
+
+    SECTION("Retired expectations can still be removed.")
+    {
+        REQUIRE_CALL(*expectations[1], is_satisfied())
+            .RETURN(true);
+        REQUIRE_NOTHROW(storage.remove(handles[1]));
+    }
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection tries the last winner first.",
+    "[expectation]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(3);
+    for (auto& exp : expectations)
+    {
+        exp = std::make_shared<ExpectationMock>();
+        storage.push(exp);
+    }
+
+    CallInfoT const call{
+        .args = {},
+        .fromCategory = ValueCategory::any,
+        .fromConstness = Constness::any};
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
+
+    {
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[2], is_applicable())
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("Younger expectations, which are known to be inapplicable, are not queried again.")
+    {
+        FORBID_CALL(*expectations[2], is_matching(_));
+
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("When the last winner does not match, it's not queried twice.")
+    {
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("A newly pushed expectation is considered.")
+    {
+        auto const younger = std::make_shared<ExpectationMock>();
+        storage.push(younger);
+
+        REQUIRE_CALL(*younger, is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*younger, is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*younger, report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*younger, consume(_));
+        REQUIRE_CALL(*younger, finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection selects the best match by the sequence ratings.",
+    "[expectation][sequence]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(3);
+    for (auto& exp : expectations)
+    {
+        exp = std::make_shared<ExpectationMock>();
+        exp->sequenceCount = 1u;
+        storage.push(exp);
+    }
+
+    CallInfoT const call{
+        .args = {},
+        .fromCategory = ValueCategory::any,
+        .fromConstness = Constness::any};
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
+
+    constexpr sequence::Tag tag{42};
+
+    REQUIRE_CALL(*expectations[2], is_matching(_))
+        .RETURN(true);
+    REQUIRE_CALL(*expectations[2], is_applicable())
+        .RETURN(true);
+    REQUIRE_CALL(*expectations[2], sequence_ratings(_))
+        .SIDE_EFFECT(_1[0] = (sequence::rating{1, tag}))
+        .RETURN(1u);
+
+    SECTION("All applicable matches are rated.")
+    {
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], sequence_ratings(_))
+            .SIDE_EFFECT(_1[0] = (sequence::rating{2, tag}))
+            .RETURN(1u);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], sequence_ratings(_))
+            .SIDE_EFFECT(_1[0] = (sequence::rating{0, tag}))
+            .RETURN(1u);
+
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("The scan stops, when the current best match has no ratings.")
+    {
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], sequence_ratings(_))
+            .RETURN(0u);
+
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    REQUIRE_THAT(
+        reporter.full_match_reports(),
+        Catch::Matchers::SizeIs(1));
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection just queries the head, when the expectations form a strictly ordered queue.",
+    "[expectation][sequence]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    constexpr sequence::Tag tag{42};
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(3);
+    for (int i{}; auto& exp : expectations)
+    {
+        exp = std::make_shared<ExpectationMock>();
+        exp->sequenceCount = 1u;
+        exp->sequencePosition = sequence::position{tag, i++};
+    }
+
+    CallInfoT const call{
+        .args = {},
+        .fromCategory = ValueCategory::any,
+        .fromConstness = Constness::any};
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
+
+    SECTION("When pushed in order of their positions.")
+    {
+        for (auto const& exp : expectations)
+        {
+            storage.push(exp);
+        }
+
+        FORBID_CALL(*expectations[2], is_matching(_));
+        FORBID_CALL(*expectations[1], is_matching(_));
+
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("When not pushed in order of their positions, all are queried.")
+    {
+        storage.push(expectations[1]);
+        storage.push(expectations[0]);
+        storage.push(expectations[2]);
+
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], sequence_ratings(_))
+            .SIDE_EFFECT(_1[0] = (sequence::rating{1, tag}))
+            .RETURN(1u);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("When another expectation is not part of the queue, all are queried.")
+    {
+        expectations[1]->sequencePosition.reset();
+        for (auto const& exp : expectations)
+        {
+            storage.push(exp);
+        }
+
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], sequence_ratings(_))
+            .SIDE_EFFECT(_1[0] = (sequence::rating{1, tag}))
+            .RETURN(1u);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+
+    SECTION("When the head is inapplicable, the general scan is performed.")
+    {
+        for (auto const& exp : expectations)
+        {
+            storage.push(exp);
+        }
+
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .TIMES(2)
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .TIMES(2)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], sequence_ratings(_))
+            .SIDE_EFFECT(_1[0] = (sequence::rating{1, tag}))
+            .RETURN(1u);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
+}
+
+TEST_CASE(
+    "mimicpp::ExpectationCollection only queries expectations, which accept the overload-qualification of the call.",
+    "[expectation]")
+{
+    using namespace mimicpp::call;
+    using StorageT = ExpectationCollection<void()>;
+    using CallInfoT = Info<void>;
+    using trompeloeil::_;
+
+    ScopedReporter reporter{};
+    StorageT storage{};
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(4);
+    for (auto& exp : expectations)
+    {
+        exp = std::make_shared<ExpectationMock>();
+    }
+    expectations[1]->qualifications = {Constness::non_const, ValueCategory::lvalue};
+    expectations[2]->qualifications = {Constness::as_const, ValueCategory::any};
+    expectations[3]->qualifications = {Constness::non_const, ValueCategory::any};
+    for (auto const& exp : expectations)
+    {
+        storage.push(exp);
+    }
+
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>()};
 
-    ScopedReporter reporter{};
-    SECTION("When expectation is satisfied, nothing is reported.")
+    SECTION("When called from a non-const lvalue.")
     {
-        REQUIRE_CALL(*expectation, is_satisfied())
+        CallInfoT const call{
+            .args = {},
+            .fromCategory = ValueCategory::lvalue,
+            .fromConstness = Constness::non_const};
+
+        FORBID_CALL(*expectations[2], is_matching(_));
+
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[3], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .IN_SEQUENCE(sequence)
             .RETURN(true);
-        REQUIRE_NOTHROW(storage.remove(expectation));
-        REQUIRE_THAT(
-            reporter.unfulfilled_expectations(),
-            Catch::Matchers::IsEmpty());
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
     }
 
-    SECTION("When expectation is unfulfilled, it is reported.")
+    SECTION("When called from a const rvalue.")
     {
-        reporting::ExpectationReport const expReport{
-            .target = make_common_target_report<void()>(),
-            .controlReport = commonUnsatisfiedState};
+        CallInfoT const call{
+            .args = {},
+            .fromCategory = ValueCategory::rvalue,
+            .fromConstness = Constness::as_const};
 
-        REQUIRE_CALL(*expectation, is_satisfied())
+        FORBID_CALL(*expectations[1], is_matching(_));
+        FORBID_CALL(*expectations[3], is_matching(_));
+
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .IN_SEQUENCE(sequence)
             .RETURN(false);
-        REQUIRE_CALL(*expectation, report())
-            .RETURN(expReport);
-        REQUIRE_NOTHROW(storage.remove(expectation));
-        REQUIRE_THAT(
-            reporter.unfulfilled_expectations(),
-            Catch::Matchers::SizeIs(1));
-        REQUIRE(expReport == reporter.unfulfilled_expectations().at(0));
+        REQUIRE_CALL(*expectations[0], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
     }
-}
 
-namespace
-{
-    inline reporting::RequirementOutcomes const commonMatchingOutcome{
-        .outcomes = {true}};
+    SECTION("When called from any overload.")
+    {
+        CallInfoT const call{
+            .args = {},
+            .fromCategory = ValueCategory::any,
+            .fromConstness = Constness::any};
 
-    inline reporting::RequirementOutcomes const commonNonMatchingOutcome{
-        .outcomes = {true, false}
-    };
+        trompeloeil::sequence sequence{};
+        REQUIRE_CALL(*expectations[3], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[2], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
+            .IN_SEQUENCE(sequence)
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], report())
+            .RETURN(expectationReport);
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
+    }
 }
 
 TEST_CASE(
-    "mimicpp::ExpectationCollection queries its expectations, whether they match the call, in reverse order of construction.",
+    "mimicpp::ExpectationCollection only considers fallbacks, when no regular expectation is applicable.",
     "[expectation]")
 {
     using namespace mimicpp::call;
@@ -114,10 +907,14 @@ TEST_CASE(
 
     ScopedReporter reporter{};
     StorageT storage{};
-    std::vector<std::shared_ptr<ExpectationMock>> expectations(4);
+    std::vector<std::shared_ptr<ExpectationMock>> expectations(3);
     for (auto& exp : expectations)
     {
         exp = std::make_shared<ExpectationMock>();
+    }
+    expectations[1]->isFallback = true;
+    for (auto const& exp : expectations)
+    {
         storage.push(exp);
     }
 
@@ -128,132 +925,51 @@ TEST_CASE(
     reporting::ExpectationReport const expectationReport{
         .target = make_common_target_report<void()>()};
 
-    SECTION("If a full match is found.")
+    SECTION("When a regular expectation is applicable, fallbacks are not queried.")
     {
+        FORBID_CALL(*expectations[1], is_matching(_));
+
         trompeloeil::sequence sequence{};
-        REQUIRE_CALL(*expectations[3], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[2], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[1], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+        REQUIRE_CALL(*expectations[2], is_matching(_))
             .IN_SEQUENCE(sequence)
-            .RETURN(commonMatchingOutcome);
-        REQUIRE_CALL(*expectations[0], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
             .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[1], consume(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence);
-        REQUIRE_CALL(*expectations[1], finalize_call(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence);
-
-        REQUIRE_CALL(*expectations[1], is_applicable())
             .RETURN(true);
-        REQUIRE_CALL(*expectations[1], report())
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[0], report())
             .RETURN(expectationReport);
-
+        REQUIRE_CALL(*expectations[0], consume(_));
+        REQUIRE_CALL(*expectations[0], finalize_call(_));
         REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
-        REQUIRE_THAT(
-            reporter.no_match_reports(),
-            Catch::Matchers::IsEmpty());
-        REQUIRE_THAT(
-            reporter.inapplicable_match_reports(),
-            Catch::Matchers::IsEmpty());
-        REQUIRE_THAT(
-            reporter.full_match_reports(),
-            Catch::Matchers::SizeIs(1));
     }
 
-    SECTION("If at least one matches but is inapplicable.")
+    SECTION("Otherwise, fallbacks are queried.")
     {
-        trompeloeil::sequence sequence{};
-        REQUIRE_CALL(*expectations[3], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[2], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonMatchingOutcome);
-        REQUIRE_CALL(*expectations[1], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[0], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-
-        REQUIRE_CALL(*expectations[2], is_applicable())
-            .RETURN(false);
-        REQUIRE_CALL(*expectations[2], report())
-            .RETURN(expectationReport);
-
-        REQUIRE_THROWS_AS(
-            storage.handle_call(make_common_target_report<void()>(), call),
-            NonApplicableMatchError);
-        REQUIRE_THAT(
-            reporter.no_match_reports(),
-            Catch::Matchers::IsEmpty());
-        REQUIRE_THAT(
-            reporter.inapplicable_match_reports(),
-            Catch::Matchers::SizeIs(1u));
-        REQUIRE_THAT(
-            reporter.full_match_reports(),
-            Catch::Matchers::IsEmpty());
-    }
+        bool const isApplicable = GENERATE(false, true);
+        CAPTURE(isApplicable);
 
-    SECTION("If none matches.")
-    {
         trompeloeil::sequence sequence{};
-        REQUIRE_CALL(*expectations[3], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
-            .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[2], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+        REQUIRE_CALL(*expectations[2], is_matching(_))
             .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[1], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[0], is_matching(_))
             .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-        REQUIRE_CALL(*expectations[0], matches(_))
-            .LR_WITH(_1.fromSourceLocation == call.fromSourceLocation)
+            .RETURN(isApplicable);
+        REQUIRE_CALL(*expectations[0], is_applicable())
+            .TIMES(isApplicable ? 1 : 0)
+            .RETURN(false);
+        REQUIRE_CALL(*expectations[1], is_matching(_))
             .IN_SEQUENCE(sequence)
-            .RETURN(commonNonMatchingOutcome);
-
-        REQUIRE_CALL(*expectations[3], report())
-            .RETURN(expectationReport);
-        REQUIRE_CALL(*expectations[2], report())
-            .RETURN(expectationReport);
+            .RETURN(true);
+        REQUIRE_CALL(*expectations[1], is_applicable())
+            .RETURN(true);
         REQUIRE_CALL(*expectations[1], report())
             .RETURN(expectationReport);
-        REQUIRE_CALL(*expectations[0], report())
-            .RETURN(expectationReport);
-
-        REQUIRE_THROWS_AS(
-            storage.handle_call(make_common_target_report<void()>(), call),
-            NoMatchError);
-        REQUIRE_THAT(
-            reporter.no_match_reports(),
-            Catch::Matchers::SizeIs(1u));
-        REQUIRE_THAT(
-            std::get<1>(reporter.no_match_reports().front()),
-            Catch::Matchers::SizeIs(4u));
-        REQUIRE_THAT(
-            reporter.inapplicable_match_reports(),
-            Catch::Matchers::IsEmpty());
-        REQUIRE_THAT(
-            reporter.full_match_reports(),
-            Catch::Matchers::IsEmpty());
+        REQUIRE_CALL(*expectations[1], consume(_));
+        REQUIRE_CALL(*expectations[1], finalize_call(_));
+        REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
     }
 }
 
@@ -275,19 +991,15 @@ TEST_CASE(
         .args = {},
         .fromCategory = ValueCategory::any,
         .fromConstness = Constness::any};
-    reporting::ExpectationReport const expectationReport{
-        .target = make_common_target_report<void()>()};
-
     settings::report_success().store(false);
 
-    REQUIRE_CALL(*expectation, matches(_))
-        .RETURN(commonMatchingOutcome);
+    REQUIRE_CALL(*expectation, is_matching(_))
+        .RETURN(true);
     REQUIRE_CALL(*expectation, is_applicable())
         .RETURN(true);
     REQUIRE_CALL(*expectation, consume(_));
     REQUIRE_CALL(*expectation, finalize_call(_));
-    REQUIRE_CALL(*expectation, report())
-        .RETURN(expectationReport);
+    FORBID_CALL(*expectation, report());
     REQUIRE_NOTHROW(storage.handle_call(make_common_target_report<void()>(), call));
     CHECK_THAT(
         reporter.no_match_reports(),
@@ -358,12 +1070,12 @@ TEST_CASE(
 
     SECTION("When an exception is thrown during matches.")
     {
-        REQUIRE_CALL(*throwingExpectation, matches(_))
+        REQUIRE_CALL(*throwingExpectation, is_matching(_))
             .THROW(Exception{});
         REQUIRE_CALL(*throwingExpectation, report())
             .RETURN(throwingReport);
-        REQUIRE_CALL(*otherExpectation, matches(_))
-            .RETURN(commonMatchingOutcome);
+        REQUIRE_CALL(*otherExpectation, is_matching(_))
+            .RETURN(true);
         REQUIRE_CALL(*otherExpectation, is_applicable())
             .RETURN(true);
         REQUIRE_CALL(*otherExpectation, report())
@@ -440,10 +1152,84 @@ TEST_CASE(
 
     REQUIRE(from == expectation.from());
     REQUIRE_THAT(
-        target.name,
+        target.name(),
         Catch::Matchers::Equals(expectation.mock_name()));
 }
 
+TEST_CASE(
+    "mimicpp::BasicExpectation::qualification combines the qualifications of all its policies.",
+    "[expectation]")
+{
+    using ControlPolicyT = ControlPolicyFake;
+    using FinalizerT = FinalizerFake<void()>;
+
+    SECTION("Without any qualified policy.")
+    {
+        BasicExpectation<void(), ControlPolicyT, FinalizerT> const expectation{
+            {},
+            make_common_target_report<void()>(),
+            ControlPolicyT{},
+            FinalizerT{}};
+
+        CHECK(std::tuple{Constness::any, ValueCategory::any} == expectation.qualification());
+    }
+
+    SECTION("With qualified policies.")
+    {
+        BasicExpectation<
+            void(),
+            ControlPolicyT,
+            FinalizerT,
+            expectation_policies::Category<ValueCategory::rvalue>,
+            expectation_policies::Constness<Constness::as_const>> const expectation{
+            {},
+            make_common_target_report<void()>(),
+            ControlPolicyT{},
+            FinalizerT{},
+            expectation_policies::Category<ValueCategory::rvalue>{},
+            expectation_policies::Constness<Constness::as_const>{}};
+
+        CHECK(std::tuple{Constness::as_const, ValueCategory::rvalue} == expectation.qualification());
+    }
+}
+
+TEST_CASE(
+    "mimicpp::BasicExpectation is a fallback, when any of its policies says so.",
+    "[expectation]")
+{
+    using ControlPolicyT = ControlPolicyFake;
+    using FinalizerT = FinalizerFake<void()>;
+
+    SECTION("Without any fallback policy.")
+    {
+        BasicExpectation<void(), ControlPolicyT, FinalizerT> const expectation{
+            {},
+            make_common_target_report<void()>(),
+            ControlPolicyT{},
+            FinalizerT{}};
+
+        CHECK(!expectation.is_fallback());
+    }
+
+    SECTION("With a fallback policy.")
+    {
+        BasicExpectation<
+            void(),
+            ControlPolicyT,
+            FinalizerT,
+            expectation_policies::Constness<Constness::as_const>,
+            expectation_policies::Fallback> const expectation{
+            {},
+            make_common_target_report<void()>(),
+            ControlPolicyT{},
+            FinalizerT{},
+            expectation_policies::Constness<Constness::as_const>{},
+            expect::as_fallback()};
+
+        CHECK(expectation.is_fallback());
+    }
+}
+
 TEST_CASE(
     "Control policy of mimicpp::BasicExpectation controls, how often its expectations must be matched.",
     "[expectation]")
@@ -635,6 +1421,7 @@ TEMPLATE_TEST_CASE(
         REQUIRE_THAT(
             outcomes.outcomes,
             Catch::Matchers::IsEmpty());
+        REQUIRE(std::as_const(expectation).is_matching(call));
         REQUIRE_NOTHROW(expectation.consume(call));
     }
 
@@ -678,6 +1465,15 @@ TEMPLATE_TEST_CASE(
                 Catch::Matchers::RangeEquals(std::array{false}));
         }
 
+        SECTION("When calling is_matching()")
+        {
+            bool const isMatching = GENERATE(false, true);
+            REQUIRE_CALL(policy, matches(_))
+                .LR_WITH(&_1 == &call)
+                .RETURN(isMatching);
+            REQUIRE(isMatching == std::as_const(expectation).is_matching(call));
+        }
+
         REQUIRE_CALL(policy, consume(_))
             .LR_WITH(&_1 == &call);
         expectation.consume(call);
@@ -755,6 +1551,28 @@ TEMPLATE_TEST_CASE(
                 Catch::Matchers::RangeEquals(std::array{isMatching1, isMatching2}));
         }
 
+        SECTION("When calling is_matching(), the evaluation stops at the first failing policy.")
+        {
+            bool const isMatching1 = GENERATE(false, true);
+            bool const isMatching2 = GENERATE(false, true);
+
+            REQUIRE_CALL(policy1, matches(_))
+                .LR_WITH(&_1 == &call)
+                .RETURN(isMatching1);
+            auto policy2Expectation = std::invoke(
+                [&]() -> std::unique_ptr<trompeloeil::expectation> {
+                    if (isMatching1)
+                    {
+                        return NAMED_REQUIRE_CALL(policy2, matches(_))
+                            .LR_WITH(&_1 == &call)
+                            .RETURN(isMatching2);
+                    }
+                    return nullptr;
+                });
+
+            REQUIRE((isMatching1 && isMatching2) == std::as_const(expectation).is_matching(call));
+        }
+
         SECTION("When calling consume()")
         {
             REQUIRE_CALL(policy1, consume(_))
@@ -1109,8 +1927,8 @@ TEST_CASE(
     ScopedReporter reporter{};
 
     reporting::TargetReport const targetReport{
-        .name = "Test",
-        .overloadReport = reporting::TypeReport::make<SignatureT>()};
+        "Test",
+        reporting::TypeReport::make<SignatureT>()};
 
     CallInfoT const call{
         .args = {},
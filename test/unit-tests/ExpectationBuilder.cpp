@@ -38,8 +38,8 @@ namespace
     reporting::TargetReport make_common_target_report()
     {
         return reporting::TargetReport{
-            .name = "Mock-Name",
-            .overloadReport = reporting::TypeReport::make<Signature>()};
+            "Mock-Name",
+            reporting::TypeReport::make<Signature>()};
     }
 }
 
@@ -0,0 +1,314 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/ExpectationFeed.hpp"
+#include "mimic++/Mock.hpp"
+#include "mimic++/policies/ControlPolicies.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include "TestReporter.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace mimicpp;
+
+namespace
+{
+    struct Row
+    {
+        int arg;
+        int result;
+    };
+}
+
+TEST_CASE(
+    "ExpectationFeed materializes the rows lazily and in order.",
+    "[expectation][feed]")
+{
+    std::vector<Row> const rows{
+        {1, 10},
+        {2, 20},
+        {1, 30}
+    };
+
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    std::size_t materialized{};
+    auto const factory = [&](Row const& row) {
+        ++materialized;
+        return mock.expect_call(row.arg)
+           and finally::returns(row.result);
+    };
+
+    std::optional<ScopedExpectation> expectation{ExpectationFeed{rows, factory}};
+    CHECK(1u == materialized);
+    CHECK(!expectation->is_satisfied());
+
+    CHECK(10 == mock(1));
+    CHECK(2u == materialized);
+
+    SECTION("Just the current row is considered.")
+    {
+        REQUIRE_THROWS_AS(
+            mock(1),
+            NoMatchError);
+    }
+
+    CHECK(20 == mock(2));
+    CHECK(3u == materialized);
+    CHECK(!expectation->is_satisfied());
+
+    CHECK(30 == mock(1));
+    CHECK(3u == materialized);
+    CHECK(expectation->is_satisfied());
+
+    REQUIRE_THROWS_AS(
+        mock(1),
+        NonApplicableMatchError);
+
+    expectation.reset();
+    CHECK_THAT(
+        reporter.unfulfilled_expectations(),
+        Catch::Matchers::IsEmpty());
+}
+
+TEST_CASE(
+    "ExpectationFeed advances, when the current row is saturated.",
+    "[expectation][feed]")
+{
+    std::vector<int> const rows{1, 2};
+
+    ScopedReporter reporter{};
+    Mock<void(int)> mock{};
+    ScopedExpectation const expectation = ExpectationFeed{
+        rows,
+        [&](int const arg) { return mock.expect_call(arg) and expect::twice(); }};
+
+    mock(1);
+    REQUIRE_THROWS_AS(
+        mock(2),
+        NoMatchError);
+
+    mock(1);
+    mock(2);
+    CHECK(!expectation.is_satisfied());
+    mock(2);
+    CHECK(expectation.is_satisfied());
+}
+
+TEST_CASE(
+    "ExpectationFeed stays usable, when the factory throws.",
+    "[expectation][feed]")
+{
+    std::vector<Row> const rows{
+        {1, 10},
+        {2, 20},
+        {3, 30}
+    };
+
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    int failures{2};
+    ScopedExpectation const expectation = ExpectationFeed{
+        rows,
+        [&](Row const& row) {
+            if (2 == row.arg && 0 < failures)
+            {
+                --failures;
+                throw std::runtime_error{"Test"};
+            }
+
+            return mock.expect_call(row.arg)
+               and finally::returns(row.result);
+        }};
+
+    // The first failure happens after the call has been handled, thus it's just retried later.
+    CHECK(10 == mock(1));
+    CHECK(1 == failures);
+
+    // The retry fails again, which is then reported.
+    REQUIRE_THROWS_AS(
+        mock(2),
+        NoMatchError);
+    CHECK(0 == failures);
+    CHECK_THAT(
+        reporter.unhandled_exceptions(),
+        Catch::Matchers::SizeIs(1u));
+
+    CHECK(20 == mock(2));
+    CHECK(30 == mock(3));
+    CHECK(expectation.is_satisfied());
+}
+
+TEST_CASE(
+    "ExpectationFeed factories may use the targeted mock.",
+    "[expectation][feed]")
+{
+    std::vector<int> const rows{1, 2};
+
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    ScopedExpectation const other = mock.expect_call(0)
+                                and expect::any_times()
+                                and finally::returns(0);
+    ScopedExpectation const expectation = ExpectationFeed{
+        rows,
+        [&](int const arg) {
+            REQUIRE(0 == mock(0));
+
+            return mock.expect_call(arg)
+               and finally::returns(arg);
+        }};
+
+    CHECK(1 == mock(1));
+    CHECK(2 == mock(2));
+    CHECK(expectation.is_satisfied());
+}
+
+TEST_CASE(
+    "ExpectationFeed reports the current row, when unfulfilled.",
+    "[expectation][feed]")
+{
+    std::vector<Row> const rows{
+        {1, 10},
+        {2, 20},
+        {3, 30}
+    };
+
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+
+    util::SourceLocation const before{};
+    {
+        ScopedExpectation const expectation = ExpectationFeed{
+            rows,
+            [&](Row const& row) { return mock.expect_call(row.arg) and finally::returns(row.result); }};
+        CHECK(10 == mock(1));
+    }
+
+    REQUIRE_THAT(
+        reporter.unfulfilled_expectations(),
+        Catch::Matchers::SizeIs(1u));
+    reporting::ExpectationReport const& report = reporter.unfulfilled_expectations().front();
+    CHECK(std::optional<std::size_t>{1u} == report.rowIndex);
+    CHECK(before.file_name() == report.from.file_name());
+    CHECK(before.line() < report.from.line());
+}
+
+TEST_CASE(
+    "ExpectationFeed accepts input-ranges.",
+    "[expectation][feed]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    std::size_t materialized{};
+
+    // Behaves like a generator, as each row is computed just when it's pulled.
+    auto rows = std::views::iota(0, 1'000)
+              | std::views::transform([&](int const i) { ++materialized; return i; });
+
+    ScopedExpectation const expectation = ExpectationFeed{
+        std::move(rows),
+        [&](int const i) { return mock.expect_call(i) and finally::returns(2 * i); }};
+
+    for (int i{}; i < 1'000; ++i)
+    {
+        REQUIRE(2 * i == mock(i));
+        REQUIRE(std::cmp_less_equal(materialized, i + 2));
+    }
+
+    CHECK(expectation.is_satisfied());
+}
+
+TEST_CASE(
+    "ExpectationFeed requires at least one row.",
+    "[expectation][feed]")
+{
+    Mock<void()> mock{};
+
+    REQUIRE_THROWS_AS(
+        (ScopedExpectation{ExpectationFeed{std::vector<int>{}, [&](int) { return mock.expect_call(); }}}),
+        std::invalid_argument);
+}
+
+namespace
+{
+    class CountingResource final
+        : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocationCount{};
+        std::size_t outstandingBytes{};
+
+    private:
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            ++allocationCount;
+            outstandingBytes += bytes;
+
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) override
+        {
+            outstandingBytes -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE(
+    "ExpectationFeed allocates from the memory-resource of the mock.",
+    "[expectation][feed]")
+{
+    std::vector<Row> const rows{
+        {1, 10},
+        {2, 20}
+    };
+
+    CountingResource mockResource{};
+    CountingResource defaultResource{};
+    {
+        Mock<int(int)> mock{
+            MockSettings{.memoryResource = &mockResource}};
+        auto const factory = [&](Row const& row) {
+            return mock.expect_call(matches::_)
+               and finally::returns(row.result);
+        };
+
+        // Ensures, that the internal storage doesn't grow during the actual test.
+        std::ignore = ScopedExpectation{
+            mock.expect_call(matches::_)
+            and expect::never()
+            and finally::returns(0)};
+        std::size_t const mockAllocations = mockResource.allocationCount;
+
+        settings::ScopedMemoryResource const guard{defaultResource};
+        ScopedExpectation const expectation = ExpectationFeed{rows, factory};
+        // The first row and the feed itself.
+        CHECK(mockAllocations + 2u == mockResource.allocationCount);
+        // The cursor, which has to be allocated before the mock is known.
+        CHECK(1u == defaultResource.allocationCount);
+
+        CHECK(10 == mock(1));
+        CHECK(20 == mock(2));
+    }
+
+    CHECK(0u == mockResource.outstandingBytes);
+    CHECK(0u == defaultResource.outstandingBytes);
+}
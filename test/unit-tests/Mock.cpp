@@ -4,11 +4,22 @@
 //          https://www.boost.org/LICENSE_1_0.txt)
 
 #include "mimic++/Mock.hpp"
+#include "mimic++/ScopedSequence.hpp"
 #include "mimic++/policies/FinalizerPolicies.hpp"
 
 #include "TestReporter.hpp"
 #include "TestTypes.hpp"
 
+#include <atomic>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 using namespace mimicpp;
 
 // This disables the std::invocable checks for Mocks, due to an issue on clang 18.1
@@ -423,8 +434,8 @@ namespace
         bool match(std::tuple<reporting::CallReport, reporting::ExpectationReport> const& entry) const
         {
             auto const& [callReport, expectationReport] = entry;
-            return callReport.target.overloadReport == m_SignatureReport
-                && expectationReport.target.overloadReport == m_SignatureReport;
+            return callReport.target.overload_report() == m_SignatureReport
+                && expectationReport.target.overload_report() == m_SignatureReport;
         }
 
         [[nodiscard]]
@@ -1248,4 +1259,782 @@ TEST_CASE(
 #endif
         }
     }
+
+    SECTION("When a generator is given, the name is generated on demand.")
+    {
+        static std::size_t generatorCalls{};
+        generatorCalls = 0u;
+
+        Mock<void()> mock{
+            MockSettings{
+                .nameGenerator = [](StringViewT const context) {
+                    ++generatorCalls;
+                    return StringT{"Generated"} + StringT{context};
+                },
+                .nameContext = "Mock"}};
+        ScopedExpectation const expectation = mock.expect_call()
+                                          and expect::never();
+        CHECK(0u == generatorCalls);
+
+        CHECK_THAT(
+            expectation.mock_name(),
+            Catch::Matchers::Equals("GeneratedMock"));
+        CHECK(std::addressof(expectation.mock_name()) == std::addressof(expectation.mock_name()));
+        CHECK(1u == generatorCalls);
+    }
+
+    SECTION("The name-context is owned by the mock.")
+    {
+        // The context-string is a temporary, thus it's already destroyed, when the name is actually generated.
+        Mock<void()> mock{
+            MockSettings{
+                .nameGenerator = [](StringViewT const context) { return StringT{context}; },
+                .nameContext = StringT(64u, 'x')}};
+
+        ScopedExpectation const expectation = mock.expect_call()
+                                          and expect::never();
+        CHECK_THAT(
+            expectation.mock_name(),
+            Catch::Matchers::Equals(StringT(64u, 'x')));
+    }
+}
+
+TEST_CASE(
+    "Mocks can be called concurrently.",
+    "[mock][thread-safety]")
+{
+    constexpr int threadCount{8};
+    constexpr int callsPerThread{500};
+
+    CallConcurrency const concurrency = GENERATE(CallConcurrency::serialized, CallConcurrency::optimistic);
+    Mock<int(int)> mock{
+        MockSettings{.callConcurrency = concurrency}};
+
+    // Some younger non-matching expectations, which are evaluated concurrently.
+    // Saturated expectations are never evaluated, thus they must accept any amount of calls.
+    std::vector<ScopedExpectation> others{};
+    for (int i{}; i < 10; ++i)
+    {
+        others.emplace_back(
+            mock.expect_call(-1 - i)
+            and expect::any_times()
+            and finally::returns(-1));
+    }
+
+    ScopedExpectation const expectation = mock.expect_call(matches::ge(0))
+                                      and expect::times(threadCount * callsPerThread)
+                                      and finally::returns(42);
+
+    std::atomic_int sum{};
+    {
+        std::vector<std::thread> threads{};
+        for (int t{}; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t] {
+                for (int i{}; i < callsPerThread; ++i)
+                {
+                    sum += mock(t);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    CHECK(42 * threadCount * callsPerThread == sum);
+    CHECK(expectation.is_satisfied());
+    CHECK(!expectation.is_applicable());
+}
+
+TEST_CASE(
+    "Mocks never evaluate the requirements of concurrent calls in parallel by default.",
+    "[mock][thread-safety]")
+{
+    constexpr int threadCount{8};
+    constexpr int callsPerThread{200};
+
+    Mock<int(int)> mock{};
+
+    // Intentionally unsynchronized, like most stateful matchers.
+    int evaluations{};
+    std::atomic_bool isEvaluating{};
+    std::atomic_int overlaps{};
+    ScopedExpectation const expectation = mock.expect_call(
+                                              matches::predicate([&](int) {
+                                                  if (isEvaluating.exchange(true))
+                                                  {
+                                                      ++overlaps;
+                                                  }
+                                                  ++evaluations;
+                                                  std::this_thread::yield();
+                                                  isEvaluating = false;
+
+                                                  return true;
+                                              }))
+                                      and expect::any_times()
+                                      and finally::returns(42);
+
+    {
+        std::vector<std::thread> threads{};
+        for (int t{}; t < threadCount; ++t)
+        {
+            threads.emplace_back([&] {
+                for (int i{}; i < callsPerThread; ++i)
+                {
+                    std::ignore = mock(i);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    CHECK(0 == overlaps);
+    CHECK(threadCount * callsPerThread == evaluations);
+}
+
+TEST_CASE(
+    "Finalizers may call into the same mock.",
+    "[mock][thread-safety]")
+{
+    CallConcurrency const concurrency = GENERATE(CallConcurrency::serialized, CallConcurrency::optimistic);
+    Mock<int(int)> mock{
+        MockSettings{.callConcurrency = concurrency}};
+
+    SECTION("When another expectation is selected.")
+    {
+        SCOPED_EXP mock.expect_call(1)
+            and finally::returns(42);
+        SCOPED_EXP mock.expect_call(0)
+            and finally::returns_result_of([&] { return mock(1) + 1; });
+
+        CHECK(43 == mock(0));
+    }
+
+    SECTION("When the same expectation is selected.")
+    {
+        int depth{};
+        SCOPED_EXP mock.expect_call(matches::_)
+            and expect::times(3)
+            and finally::returns_result_of([&] { return 3 == ++depth ? depth : mock(0); });
+
+        CHECK(3 == mock(0));
+    }
+}
+
+TEST_CASE(
+    "Finalizers may wait for other threads, which call the same mock.",
+    "[mock][thread-safety]")
+{
+    CallConcurrency const concurrency = GENERATE(CallConcurrency::serialized, CallConcurrency::optimistic);
+    Mock<int(int)> mock{
+        MockSettings{.callConcurrency = concurrency}};
+
+    SCOPED_EXP mock.expect_call(1)
+        and finally::returns(42);
+    SCOPED_EXP mock.expect_call(0)
+        and finally::returns_result_of([&] {
+              int result{};
+              std::thread{[&] { result = mock(1); }}.join();
+
+              return result + 1;
+          });
+
+    CHECK(43 == mock(0));
+}
+
+TEST_CASE(
+    "Mocks only evaluate those indexed expectations, whose expected first argument may be equal to the actual one.",
+    "[mock][expectation]")
+{
+    Mock<void(int)> mock{};
+
+    int evaluations{};
+    auto const countingMatcher = matches::predicate([&](int) {
+        ++evaluations;
+        return true;
+    });
+
+    std::vector<ScopedExpectation> expectations{};
+    for (int i{}; i < 100; ++i)
+    {
+        expectations.emplace_back(
+            mock.expect_call(matches::_)
+            and expect::arg<0>(countingMatcher)
+            and expect::arg<0>(matches::eq(i))
+            and expect::any_times());
+    }
+
+    mock(42);
+    CHECK(1 == evaluations);
+
+    mock(0);
+    CHECK(2 == evaluations);
+}
+
+TEST_CASE(
+    "Mocks never evaluate expectations, which are saturated from the beginning.",
+    "[mock][expectation]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+
+    int evaluations{};
+    auto const countingMatcher = matches::predicate([&](int) {
+        ++evaluations;
+        return true;
+    });
+
+    SCOPED_EXP mock.expect_call(matches::ge(0))
+        and expect::any_times()
+        and finally::returns(42);
+    SCOPED_EXP mock.expect_call(countingMatcher)
+        and expect::never()
+        and finally::returns(-1);
+    SCOPED_EXP mock.expect_call(countingMatcher)
+        and expect::times(0)
+        and finally::returns(-1);
+
+    CHECK(42 == mock(0));
+    CHECK(42 == mock(1));
+    CHECK(0 == evaluations);
+
+    // But they still contribute to the diagnostics.
+    REQUIRE_THROWS_AS(
+        mock(-1),
+        NonApplicableMatchError);
+    CHECK(2 == evaluations);
+}
+
+TEST_CASE(
+    "Mocks select the best match across indexed and unindexed expectations.",
+    "[mock][expectation]")
+{
+    Mock<int(int)> mock{};
+
+    SECTION("The youngest expectation is preferred.")
+    {
+        SCOPED_EXP mock.expect_call(42)
+            and finally::returns(1);
+        SCOPED_EXP mock.expect_call(matches::_)
+            and finally::returns(2);
+        SCOPED_EXP mock.expect_call(42)
+            and finally::returns(3);
+
+        CHECK(3 == mock(42));
+        CHECK(2 == mock(42));
+        CHECK(1 == mock(42));
+    }
+
+    SECTION("Sequences are respected.")
+    {
+        ScopedSequence sequence{};
+        sequence += mock.expect_call(matches::_)
+                and finally::returns(1);
+        sequence += mock.expect_call(42)
+                and finally::returns(2);
+
+        CHECK(1 == mock(42));
+        CHECK(2 == mock(42));
+    }
+}
+
+TEST_CASE(
+    "Mocks share their target-info between calls and expectations.",
+    "[mock][reporting]")
+{
+    ScopedReporter reporter{};
+
+    Mock<void(int)> mock{{.name = "Mock with a quite long name, which exceeds any small-string buffer"}};
+
+    SCOPED_EXP mock.expect_call(matches::_)
+        and expect::twice();
+
+    mock(42);
+    mock(1337);
+
+    REQUIRE_THAT(
+        reporter.full_match_reports(),
+        Catch::Matchers::SizeIs(2u));
+    auto const& [firstCall, firstExpectation] = reporter.full_match_reports()[0];
+    auto const& [secondCall, secondExpectation] = reporter.full_match_reports()[1];
+
+    CHECK_THAT(
+        firstCall.target.name(),
+        Catch::Matchers::Equals("Mock with a quite long name, which exceeds any small-string buffer"));
+    CHECK(std::addressof(firstCall.target.name()) == std::addressof(secondCall.target.name()));
+    CHECK(std::addressof(firstCall.target.name()) == std::addressof(firstExpectation.target.name()));
+    CHECK(std::addressof(firstCall.target.name()) == std::addressof(secondExpectation.target.name()));
+}
+
+TEST_CASE(
+    "Mocks replay strictly sequenced expectations in order.",
+    "[mock][sequence]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    Mock<void()> other{};
+
+    constexpr int stepCount{1000};
+    ScopedSequence sequence{};
+    for (int i{}; i < stepCount; ++i)
+    {
+        sequence += mock.expect_call(matches::_)
+                and finally::returns(i);
+
+        if (0 == i % 100)
+        {
+            sequence += other.expect_call();
+        }
+    }
+
+    for (int i{}; i < stepCount; ++i)
+    {
+        REQUIRE(i == mock(i));
+
+        if (0 == i % 100)
+        {
+            REQUIRE_THROWS_AS(mock(i), NonApplicableMatchError);
+            other();
+        }
+    }
+}
+
+TEST_CASE(
+    "Mocks can be bound to their owning thread.",
+    "[mock]")
+{
+    Mock<int(int), void() const> mock{
+        MockSettings{.threadAffinity = ThreadAffinity::owner}};
+
+    ScopedSequence sequence{};
+    sequence += mock.expect_call(42)
+            and finally::returns(1337);
+    sequence += std::as_const(mock).expect_call();
+    ScopedExpectation other = mock.expect_call(1)
+                          and finally::returns(-1);
+
+    CHECK(1337 == mock(42));
+    CHECK_NOTHROW(std::as_const(mock)());
+    CHECK(-1 == mock(1));
+}
+
+TEST_CASE(
+    "Mocks select the same expectations, when evaluating them in parallel.",
+    "[mock]")
+{
+    struct Outcome
+    {
+        std::vector<int> results{};
+        std::vector<std::size_t> noMatchCounts{};
+        std::size_t inapplicableCount{};
+        std::size_t unhandledExceptionCount{};
+
+        bool operator==(Outcome const&) const = default;
+    };
+
+    bool const withSequence = GENERATE(false, true);
+    auto const run = [&] {
+        ScopedReporter reporter{};
+        Mock<int(int)> mock{};
+        ScopedSequence sequence{};
+        std::vector<ScopedExpectation> expectations{};
+        for (int i{}; i < 500; ++i)
+        {
+            auto matcher = matches::predicate([i](int const x) {
+                if (0 == x % 101 && 0 == i % 7)
+                {
+                    throw std::runtime_error{"Something went wrong."};
+                }
+
+                return 0 == x % (i + 3);
+            });
+
+            if (withSequence && 0 == i % 50)
+            {
+                sequence += mock.expect_call(std::move(matcher))
+                        and expect::at_most(2)
+                        and finally::returns(i);
+            }
+            else
+            {
+                expectations.emplace_back(
+                    mock.expect_call(std::move(matcher))
+                    and expect::at_most(2)
+                    and finally::returns(i));
+            }
+        }
+
+        Outcome outcome{};
+        for (int i{}; i < 300; ++i)
+        {
+            try
+            {
+                outcome.results.emplace_back(mock(i));
+            }
+            catch (NoMatchError const&)
+            {
+                outcome.results.emplace_back(-1);
+            }
+            catch (NonApplicableMatchError const&)
+            {
+                outcome.results.emplace_back(-2);
+            }
+        }
+
+        for (auto const& [call, reports] : reporter.no_match_reports())
+        {
+            outcome.noMatchCounts.emplace_back(reports.size());
+        }
+        outcome.inapplicableCount = reporter.inapplicable_match_reports().size();
+        outcome.unhandledExceptionCount = reporter.unhandled_exceptions().size();
+
+        return outcome;
+    };
+
+    Outcome const expected = run();
+
+    std::size_t const workers = GENERATE(2u, 3u, 8u);
+    settings::parallel_evaluation_threshold() = 10u;
+    settings::parallel_evaluation_workers() = workers;
+    Outcome const actual = run();
+    settings::parallel_evaluation_threshold() = std::numeric_limits<std::size_t>::max();
+    settings::parallel_evaluation_workers() = 0u;
+
+    CHECK(expected == actual);
+}
+
+TEST_CASE(
+    "Mocks prefer regular expectations over fallbacks.",
+    "[mock]")
+{
+    Mock<int(int)> mock{};
+    ScopedExpectation fallback = mock.expect_call(matches::_)
+                             and expect::as_fallback()
+                             and expect::any_times()
+                             and finally::returns(-1);
+    ScopedExpectation regular = mock.expect_call(42)
+                            and finally::returns(42);
+    ScopedExpectation otherFallback = mock.expect_call(matches::_)
+                                  and expect::as_fallback()
+                                  and expect::any_times()
+                                  and finally::returns(-2);
+
+    CHECK(-2 == mock(1337));
+    CHECK(42 == mock(42));
+    CHECK(-2 == mock(42));
+}
+
+TEST_CASE(
+    "Mocks can verify just a sample of their calls.",
+    "[mock]")
+{
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{
+        MockSettings{.verificationInterval = 4u}};
+
+    int evaluationCount{};
+    auto matcher = matches::predicate([&](int const value) {
+        ++evaluationCount;
+        return 0 <= value;
+    });
+
+    SECTION("Unverified calls are dispatched to the most recently verified expectation.")
+    {
+        ScopedExpectation expectation = mock.expect_call(std::move(matcher))
+                                    and expect::times(8)
+                                    and finally::returns(42);
+
+        for (int i{}; i < 8; ++i)
+        {
+            REQUIRE(42 == mock(i));
+        }
+
+        CHECK(2 == evaluationCount);
+        CHECK(2u == reporter.full_match_reports().size());
+        CHECK(expectation.is_satisfied());
+    }
+
+    SECTION("Times-checks are still applied.")
+    {
+        ScopedExpectation expectation = mock.expect_call(std::move(matcher))
+                                    and finally::returns(42);
+
+        REQUIRE(42 == mock(0));
+        REQUIRE_THROWS_AS(mock(1), NonApplicableMatchError);
+        CHECK(2 == evaluationCount);
+    }
+}
+
+namespace
+{
+    class CountingResource final
+        : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocationCount{};
+        std::size_t outstandingBytes{};
+
+    private:
+        void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+        {
+            ++allocationCount;
+            outstandingBytes += bytes;
+
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) override
+        {
+            outstandingBytes -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        [[nodiscard]]
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE(
+    "Mocks allocate from the selected memory-resource.",
+    "[mock]")
+{
+    CountingResource resource{};
+
+    SECTION("When selected via the MockSettings.")
+    {
+        {
+            Mock<int(int)> mock{
+                MockSettings{.memoryResource = &resource}};
+            std::size_t const mockAllocations = resource.allocationCount;
+            CHECK(0u < mockAllocations);
+
+            ScopedExpectation expectation = mock.expect_call(42)
+                                        and finally::returns(1337);
+            CHECK(mockAllocations < resource.allocationCount);
+            REQUIRE(1337 == mock(42));
+        }
+
+        CHECK(0u == resource.outstandingBytes);
+    }
+
+    SECTION("When selected via settings::ScopedMemoryResource.")
+    {
+        {
+            settings::ScopedMemoryResource const guard{resource};
+            REQUIRE(&resource == settings::memory_resource().load());
+
+            Mock<void()> mock{};
+            std::size_t const mockAllocations = resource.allocationCount;
+            CHECK(0u < mockAllocations);
+
+            Sequence sequence{};
+            ScopedExpectation expectation = mock.expect_call()
+                                        and expect::in_sequence(sequence);
+            CHECK(mockAllocations < resource.allocationCount);
+            mock();
+        }
+
+        CHECK(nullptr == settings::memory_resource().load());
+        CHECK(0u == resource.outstandingBytes);
+
+        std::size_t const allocationCount = resource.allocationCount;
+        Mock<void()> mock{};
+        CHECK(allocationCount == resource.allocationCount);
+    }
+}
+
+TEST_CASE(
+    "ScopedExpectationBatch creates an expectation for each row.",
+    "[mock][expectation]")
+{
+    struct Row
+    {
+        int arg;
+        int result;
+    };
+
+    std::vector<Row> const rows{
+        {1, 10},
+        {2, 20},
+        {3, 30}
+    };
+
+    ScopedReporter reporter{};
+    Mock<int(int)> mock{};
+    auto const factory = [&](Row const& row) {
+        return mock.expect_call(row.arg)
+           and finally::returns(row.result);
+    };
+
+    SECTION("When all expectations are satisfied, nothing is reported.")
+    {
+        {
+            ScopedExpectationBatch const expectations{rows, factory};
+            CHECK(3u == expectations.size());
+            CHECK(!expectations.is_satisfied());
+
+            CHECK(20 == mock(2));
+            CHECK(10 == mock(1));
+            CHECK(30 == mock(3));
+            CHECK(expectations.is_satisfied());
+        }
+
+        CHECK_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::IsEmpty());
+    }
+
+    SECTION("When expectations are unsatisfied, they are reported in row-order.")
+    {
+        {
+            ScopedExpectationBatch const expectations{rows, factory};
+            CHECK(20 == mock(2));
+        }
+
+        REQUIRE_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::SizeIs(2u));
+        CHECK_THAT(
+            reporter.unfulfilled_expectations()[0].requirementDescriptions[0].value_or(""),
+            Catch::Matchers::EndsWith("1"));
+        CHECK_THAT(
+            reporter.unfulfilled_expectations()[1].requirementDescriptions[0].value_or(""),
+            Catch::Matchers::EndsWith("3"));
+
+        // The expectations have been removed from the mock.
+        REQUIRE_THROWS_AS(
+            mock(1),
+            NoMatchError);
+    }
+
+    SECTION("When the range is empty, the batch is empty.")
+    {
+        ScopedExpectationBatch const expectations{std::vector<Row>{}, factory};
+        CHECK(0u == expectations.size());
+        CHECK(expectations.is_satisfied());
+    }
+
+    SECTION("When the batch is moved, the ownership is transferred.")
+    {
+        std::optional<ScopedExpectationBatch> source{std::in_place, rows, factory};
+        ScopedExpectationBatch target{*std::move(source)};
+        source.reset();
+        CHECK(3u == target.size());
+
+        CHECK(10 == mock(1));
+        CHECK(20 == mock(2));
+        CHECK(30 == mock(3));
+    }
+
+    SECTION("When rows target different mocks, std::invalid_argument is thrown.")
+    {
+        Mock<int(int)> otherMock{};
+        bool isOther{};
+        auto const mixedFactory = [&](Row const& row) {
+            Mock<int(int)>& target = std::exchange(isOther, !isOther) ? otherMock : mock;
+            return target.expect_call(row.arg)
+               and finally::returns(row.result);
+        };
+
+        REQUIRE_THROWS_AS(
+            (ScopedExpectationBatch{rows, mixedFactory}),
+            std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            mock(1),
+            NoMatchError);
+        CHECK_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::IsEmpty());
+    }
+}
+
+TEST_CASE(
+    "Mock::verify_and_clear removes all attached expectations.",
+    "[mock]")
+{
+    ScopedReporter reporter{};
+    CountingResource resource{};
+    Mock<int(int), int(int) const, void()> mock{
+        MockSettings{.memoryResource = &resource}};
+
+    std::optional<ScopedExpectation> satisfied{
+        mock.expect_call(42)
+        and finally::returns(1337)};
+    std::optional<ScopedExpectation> unsatisfied{
+        mock.expect_call()};
+    REQUIRE(1337 == mock(42));
+
+    mock.verify_and_clear();
+
+    SECTION("Unsatisfied expectations are reported.")
+    {
+        REQUIRE_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::SizeIs(1u));
+    }
+
+    SECTION("The cleared expectations are no longer considered.")
+    {
+        REQUIRE_THROWS_AS(
+            mock(),
+            NoMatchError);
+    }
+
+    SECTION("The owners of the cleared expectations don't verify them again.")
+    {
+        satisfied.reset();
+        unsatisfied.reset();
+
+        CHECK_THAT(
+            reporter.unfulfilled_expectations(),
+            Catch::Matchers::SizeIs(1u));
+    }
+
+    SECTION("The mock can be reused.")
+    {
+        std::size_t const allocationCount = resource.allocationCount;
+        ScopedExpectation const expectation = mock.expect_call(42)
+                                          and finally::returns(42);
+
+        // Just the expectation itself is allocated, as the storage is kept.
+        CHECK(allocationCount + 1u == resource.allocationCount);
+        CHECK(satisfied->mock_name() == expectation.mock_name());
+        CHECK(42 == mock(42));
+    }
+}
+
+TEST_CASE(
+    "Mock::verify_and_clear removes the expectations of all overloads, before anything is reported.",
+    "[mock]")
+{
+    Mock<void(), void(int)> mock{};
+
+    std::optional<ScopedExpectation> first{mock.expect_call()};
+    std::optional<ScopedExpectation> second{mock.expect_call(42)};
+
+    // The DefaultReporter aborts via an exception, when an unfulfilled expectation is reported.
+    REQUIRE_THROWS_AS(
+        mock.verify_and_clear(),
+        reporting::UnfulfilledExpectationT);
+
+    REQUIRE_THROWS_AS(
+        mock(),
+        reporting::UnmatchedCallT);
+    REQUIRE_THROWS_AS(
+        mock(42),
+        reporting::UnmatchedCallT);
+
+    // Both expectations have been removed, thus their owners don't report them again.
+    REQUIRE_NOTHROW(first.reset());
+    REQUIRE_NOTHROW(second.reset());
 }
@@ -0,0 +1,200 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/Mock.hpp"
+#include "mimic++/Stub.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include "TestReporter.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace mimicpp;
+
+TEMPLATE_TEST_CASE(
+    "Stub is a non-copyable, but movable and default-constructible type.",
+    "[stub]",
+    void(),
+    void() const,
+    void() &,
+    void() const&,
+    void() &&,
+    void() const&&,
+    void() noexcept,
+    void() const noexcept,
+    void() & noexcept,
+    void() const& noexcept,
+    void() && noexcept,
+    void() const&& noexcept)
+{
+    using StubT = Stub<TestType>;
+
+    STATIC_CHECK(!std::is_copy_constructible_v<StubT>);
+    STATIC_CHECK(!std::is_copy_assignable_v<StubT>);
+
+    STATIC_CHECK(std::is_move_constructible_v<StubT>);
+    STATIC_CHECK(std::is_move_assignable_v<StubT>);
+    STATIC_CHECK(std::is_default_constructible_v<StubT>);
+
+    STATIC_CHECK(std::is_nothrow_move_constructible_v<StubT>);
+    STATIC_CHECK(std::is_nothrow_move_assignable_v<StubT>);
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "Stub provides the same call-operators as Mock.",
+    "[stub]",
+    ((bool dummy, typename Sig, typename... Args), dummy, Sig, Args...),
+    (true, void()),
+    (true, int() const),
+    (true, void(int&) &, int&),
+    (true, float && (int&) const&, int&),
+    (true, float && (std::tuple<int&>&&) &&, std::tuple<int&>&&),
+    (true, float && (std::tuple<int&>&&, std::tuple<double&&> const&) const&&, std::tuple<int&>&&, std::tuple<double&&> const&))
+{
+    using ReturnT = signature_return_type_t<Sig>;
+    using StubT = Stub<Sig>;
+    using MockT = Mock<Sig>;
+
+    STATIC_CHECK(std::is_invocable_r_v<ReturnT, StubT, Args...> == std::is_invocable_r_v<ReturnT, MockT, Args...>);
+    STATIC_CHECK(std::is_invocable_r_v<ReturnT, StubT&, Args...> == std::is_invocable_r_v<ReturnT, MockT&, Args...>);
+    STATIC_CHECK(std::is_invocable_r_v<ReturnT, StubT const&, Args...> == std::is_invocable_r_v<ReturnT, MockT const&, Args...>);
+    STATIC_CHECK(std::is_invocable_r_v<ReturnT, StubT&&, Args...> == std::is_invocable_r_v<ReturnT, MockT&&, Args...>);
+    STATIC_CHECK(std::is_invocable_r_v<ReturnT, StubT const&&, Args...> == std::is_invocable_r_v<ReturnT, MockT const&&, Args...>);
+
+    STATIC_CHECK(std::is_nothrow_invocable_v<Stub<signature_add_noexcept_t<Sig>>&, Args...> == std::is_nothrow_invocable_v<Mock<signature_add_noexcept_t<Sig>>&, Args...>);
+}
+
+TEST_CASE(
+    "Stub handles calls to overloads without a bound behavior.",
+    "[stub]")
+{
+    SECTION("When the return type is void, the call simply returns.")
+    {
+        Stub<void(int)> stub{};
+
+        REQUIRE_NOTHROW(stub(42));
+    }
+
+    SECTION("Otherwise, the call is reported as unmatched.")
+    {
+        ScopedReporter reporter{};
+        Stub<int(int)> stub{};
+
+        REQUIRE_THROWS_AS(stub(42), NoMatchError);
+
+        REQUIRE_THAT(
+            reporter.no_match_reports(),
+            Catch::Matchers::SizeIs(1));
+        auto const& [callReport, noMatchReports] = reporter.no_match_reports().front();
+        CHECK_THAT(
+            noMatchReports,
+            Catch::Matchers::IsEmpty());
+        CHECK_THAT(
+            callReport.argDetails,
+            Catch::Matchers::SizeIs(1));
+        CHECK("Stub" == callReport.target.name());
+    }
+}
+
+TEST_CASE(
+    "Stub dispatches calls to the bound behavior.",
+    "[stub]")
+{
+    SECTION("When a finalize-policy is bound.")
+    {
+        Stub<int&(int&)> stub{};
+        stub.bind(finally::returns_arg<0u>());
+
+        int value{42};
+        int& result = stub(value);
+        REQUIRE(&value == &result);
+    }
+
+    SECTION("When an action is bound, it's invoked with all arguments.")
+    {
+        Stub<void(int&, int)> stub{};
+        stub.bind([](int& out, int const in) { out = in; });
+
+        int value{};
+        stub(value, 42);
+        REQUIRE(42 == value);
+    }
+
+    SECTION("When a move-only behavior is bound.")
+    {
+        Stub<int()> stub{};
+        stub.bind([ptr = std::make_unique<int>(42)] { return *ptr; });
+
+        REQUIRE(42 == stub());
+    }
+
+    SECTION("When the behavior throws, the exception is propagated.")
+    {
+        Stub<void()> stub{};
+        stub.bind(finally::throws(std::runtime_error{"Test"}));
+
+        REQUIRE_THROWS_AS(stub(), std::runtime_error);
+    }
+
+    SECTION("Any previously bound behavior is replaced.")
+    {
+        Stub<int()> stub{};
+        stub.bind(finally::returns(42));
+        stub.bind(finally::returns(1337));
+
+        REQUIRE(1337 == stub());
+    }
+
+    SECTION("Moved stubs keep their behavior.")
+    {
+        Stub<int()> source{};
+        source.bind(finally::returns(42));
+
+        Stub<int()> target{std::move(source)};
+        REQUIRE(42 == target());
+    }
+}
+
+TEST_CASE(
+    "Stub supports overload-sets.",
+    "[stub]")
+{
+    ScopedReporter reporter{};
+    Stub<int(), int() const, void(std::string)> stub{};
+
+    SECTION("When no target is specified, the behavior is bound to all applicable overloads.")
+    {
+        stub.bind(finally::returns(42));
+
+        REQUIRE(42 == stub());
+        REQUIRE(42 == std::as_const(stub)());
+        REQUIRE_NOTHROW(stub("Hello, World!"));
+    }
+
+    SECTION("When targets are specified, just these overloads are bound.")
+    {
+        stub.bind<int() const>(finally::returns(1337));
+
+        REQUIRE(1337 == std::as_const(stub)());
+        REQUIRE_THROWS_AS(stub(), NoMatchError);
+
+        stub.bind<int(), int() const>([] { return 42; });
+        REQUIRE(42 == stub());
+        REQUIRE(42 == std::as_const(stub)());
+    }
+
+    SECTION("Behaviors are selected by the overload they accept.")
+    {
+        std::string received{};
+        stub.bind([&](std::string const& str) { received = str; });
+
+        stub("Hello, World!");
+        REQUIRE("Hello, World!" == received);
+        REQUIRE_THROWS_AS(stub(), NoMatchError);
+    }
+}
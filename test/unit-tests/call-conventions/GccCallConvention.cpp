@@ -5,6 +5,7 @@
 
 #include "mimic++/CallConvention.hpp"
 #include "mimic++/Facade.hpp"
+#include "mimic++/Stub.hpp"
 
 #define CALL_CONVENTION __attribute__((ms_abi))
 MIMICPP_REGISTER_CALL_CONVENTION(CALL_CONVENTION, call_convention)
@@ -503,6 +504,33 @@ TEST_CASE(
     }
 }
 
+TEST_CASE(
+    "Stubs support explicit call-conventions.",
+    "[stub]")
+{
+    SECTION("Signatures with const noexcept.")
+    {
+        using StubT = Stub<void CALL_CONVENTION() const noexcept>;
+        STATIC_REQUIRE(
+            std::convertible_to<
+                decltype(&StubT::operator()),
+                void (CALL_CONVENTION StubT::*)(util::SourceLocation) const noexcept>);
+    }
+
+    SECTION("Stubs still supports overloading.")
+    {
+        Stub<
+            int(),
+            int CALL_CONVENTION() const>
+            stub{};
+        stub.bind<int()>(finally::returns(42));
+        stub.bind<int CALL_CONVENTION() const>(finally::returns(1337));
+
+        REQUIRE(42 == stub());
+        REQUIRE(1337 == std::as_const(stub)());
+    }
+}
+
 TEST_CASE(
     "Interface-Mocks support explicit call-conventions.",
     "[mock]")
@@ -6,6 +6,17 @@
 #include "Common.hpp"
 #include "mimic++/Facade.hpp"
 #include "mimic++/ScopedSequence.hpp"
+#include "mimic++/policies/FinalizerPolicies.hpp"
+
+#include "TestReporter.hpp"
+
+#include <array>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 using namespace mimicpp;
 
@@ -536,89 +547,263 @@ TEST_CASE(
 
     SECTION("Mocking an unqualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void()>, decltype(Type::foo_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void()>, decltype(Type::foo_)>);
         ScopedExpectation const expectation = object.foo_.expect_call();
         REQUIRE_NOTHROW(object.foo());
     }
 
     SECTION("Mocking const qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() const>, decltype(Type::foo_const_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() const>, decltype(Type::foo_const_)>);
         ScopedExpectation const expectation = std::as_const(object).foo_const_.expect_call();
         REQUIRE_NOTHROW(std::as_const(object).foo_const());
     }
 
     SECTION("Mocking lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void()&>, decltype(Type::foo_lvalue_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void()&>, decltype(Type::foo_lvalue_)>);
         ScopedExpectation const expectation = object.foo_lvalue_.expect_call();
         REQUIRE_NOTHROW(object.foo_lvalue());
     }
 
     SECTION("Mocking const lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() const&>, decltype(Type::foo_lvalue_const_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() const&>, decltype(Type::foo_lvalue_const_)>);
         ScopedExpectation const expectation = std::as_const(object).foo_lvalue_const_.expect_call();
         REQUIRE_NOTHROW(std::as_const(object).foo_lvalue_const());
     }
 
     SECTION("Mocking rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() &&>, decltype(Type::foo_rvalue_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() &&>, decltype(Type::foo_rvalue_)>);
         ScopedExpectation const expectation = std::move(object).foo_rvalue_.expect_call();
         REQUIRE_NOTHROW(std::move(object).foo_rvalue());
     }
 
     SECTION("Mocking const rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() const&&>, decltype(Type::foo_rvalue_const_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() const&&>, decltype(Type::foo_rvalue_const_)>);
         ScopedExpectation const expectation = std::move(std::as_const(object)).foo_rvalue_const_.expect_call();
         REQUIRE_NOTHROW(std::move(std::as_const(object)).foo_rvalue_const());
     }
 
     SECTION("Mocking a noexcept member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() noexcept>, decltype(Type::foo_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() noexcept>, decltype(Type::foo_noexcept_)>);
         ScopedExpectation const expectation = object.foo_noexcept_.expect_call();
         REQUIRE_NOTHROW(object.foo_noexcept());
     }
 
     SECTION("Mocking noexcept const qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() const noexcept>, decltype(Type::foo_const_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() const noexcept>, decltype(Type::foo_const_noexcept_)>);
         ScopedExpectation const expectation = std::as_const(object).foo_const_noexcept_.expect_call();
         REQUIRE_NOTHROW(std::as_const(object).foo_const_noexcept());
     }
 
     SECTION("Mocking noexcept lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() & noexcept>, decltype(Type::foo_lvalue_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() & noexcept>, decltype(Type::foo_lvalue_noexcept_)>);
         ScopedExpectation const expectation = object.foo_lvalue_noexcept_.expect_call();
         REQUIRE_NOTHROW(object.foo_lvalue_noexcept());
     }
 
     SECTION("Mocking noexcept const lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() const & noexcept>, decltype(Type::foo_lvalue_const_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() const & noexcept>, decltype(Type::foo_lvalue_const_noexcept_)>);
         ScopedExpectation const expectation = std::as_const(object).foo_lvalue_const_noexcept_.expect_call();
         REQUIRE_NOTHROW(std::as_const(object).foo_lvalue_const_noexcept());
     }
 
     SECTION("Mocking noexcept rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() && noexcept>, decltype(Type::foo_rvalue_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() && noexcept>, decltype(Type::foo_rvalue_noexcept_)>);
         ScopedExpectation const expectation = std::move(object).foo_rvalue_noexcept_.expect_call();
         REQUIRE_NOTHROW(std::move(object).foo_rvalue_noexcept());
     }
 
     SECTION("Mocking noexcept const rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void() const && noexcept>, decltype(Type::foo_rvalue_const_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void() const && noexcept>, decltype(Type::foo_rvalue_const_noexcept_)>);
         ScopedExpectation const expectation = std::move(std::as_const(object)).foo_rvalue_const_noexcept_.expect_call();
         REQUIRE_NOTHROW(std::move(std::as_const(object)).foo_rvalue_const_noexcept());
     }
 }
 
+TEST_CASE(
+    "Member-object mocks can be reused via verify_and_clear.",
+    "[mock][mock::facade]")
+{
+    struct Type
+    {
+        MIMICPP_MAKE_MEMBER_MOCK(foo, int, ());
+    };
+
+    ScopedReporter reporter{};
+    Type object{};
+
+    ScopedExpectation const first = object.foo_.expect_call()
+                                 and finally::returns(42);
+    StringT const name = first.mock_name();
+    REQUIRE(42 == object.foo());
+
+    object.foo_.verify_and_clear();
+    CHECK_THAT(
+        reporter.unfulfilled_expectations(),
+        Catch::Matchers::IsEmpty());
+
+    ScopedExpectation const second = object.foo_.expect_call()
+                                  and finally::returns(1337);
+    CHECK(name == second.mock_name());
+    CHECK(1337 == object.foo());
+}
+
+TEST_CASE(
+    "Member-object mocks are constructed on their first usage.",
+    "[mock][mock::facade]")
+{
+    struct Type
+    {
+        MIMICPP_MAKE_MEMBER_MOCK(foo, int, ());
+        MIMICPP_MAKE_MEMBER_MOCK(bar, void, (int));
+    };
+
+    STATIC_CHECK(sizeof(facade::LazyMock<int()>) < sizeof(Mock<int()>));
+
+    ScopedReporter reporter{};
+    Type object{};
+    CHECK(!object.foo_.is_constructed());
+    CHECK(!object.bar_.is_constructed());
+
+    SECTION("When an expectation is created.")
+    {
+        ScopedExpectation const expectation = object.foo_.expect_call()
+                                          and finally::returns(42);
+        CHECK(object.foo_.is_constructed());
+        CHECK(!object.bar_.is_constructed());
+
+        CHECK(42 == object.foo());
+    }
+
+    SECTION("When invoked.")
+    {
+        REQUIRE_THROWS_AS(
+            object.foo(),
+            NoMatchError);
+        CHECK(object.foo_.is_constructed());
+        CHECK(!object.bar_.is_constructed());
+    }
+
+    SECTION("When used as drop-in replacement for the mock.")
+    {
+        STATIC_CHECK(std::convertible_to<facade::LazyMock<int()>&, Mock<int()>&>);
+        STATIC_CHECK(std::convertible_to<facade::LazyMock<int()> const&, Mock<int()> const&>);
+        // The construction of the mock may throw, thus the noexcept is not propagated.
+        STATIC_CHECK(std::invocable<facade::LazyMock<void() noexcept>&>);
+        STATIC_CHECK(!std::is_nothrow_invocable_v<facade::LazyMock<void() noexcept>&>);
+        STATIC_CHECK(!std::invocable<facade::LazyMock<void() const&&> const&>);
+
+        auto const expect = [](Mock<int()>& mock) {
+            return mock.expect_call()
+               and finally::returns(42);
+        };
+        ScopedExpectation const expectation = expect(object.foo_);
+        CHECK(object.foo_.is_constructed());
+
+        CHECK(42 == object.foo_());
+        CHECK(!object.bar_.is_constructed());
+    }
+
+    SECTION("When constructed, the mock is allocated from the selected memory-resource.")
+    {
+        class CountingResource final
+            : public std::pmr::memory_resource
+        {
+        public:
+            std::size_t outstandingBytes{};
+
+        private:
+            void* do_allocate(std::size_t const bytes, std::size_t const alignment) override
+            {
+                outstandingBytes += bytes;
+
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* const ptr, std::size_t const bytes, std::size_t const alignment) override
+            {
+                outstandingBytes -= bytes;
+                std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+            }
+
+            [[nodiscard]]
+            bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+            {
+                return this == &other;
+            }
+        } resource{};
+
+        {
+            Type other{};
+            {
+                settings::ScopedMemoryResource const guard{resource};
+                std::ignore = other.foo_.get();
+            }
+            CHECK(sizeof(Mock<int()>) < resource.outstandingBytes);
+        }
+
+        CHECK(0u == resource.outstandingBytes);
+    }
+
+#ifndef NDEBUG
+    SECTION("When bound to its owner, the thread, which uses the mock first, becomes the owner.")
+    {
+        facade::LazyMock<void()> mock{
+            [] { return MockSettings{.threadAffinity = ThreadAffinity::owner}; }};
+
+        std::thread{[&] {
+            ScopedExpectation const expectation = mock.expect_call();
+            mock();
+        }}.join();
+        CHECK(mock.is_constructed());
+        CHECK_THAT(
+            reporter.errors(),
+            Catch::Matchers::IsEmpty());
+
+        ScopedExpectation const expectation = mock.expect_call();
+        CHECK(!reporter.errors().empty());
+        mock();
+    }
+#endif
+
+    SECTION("When moved, the mock is taken over.")
+    {
+        ScopedExpectation const expectation = object.foo_.expect_call()
+                                          and finally::returns(42);
+
+        Type other{std::move(object)};
+        CHECK(other.foo_.is_constructed());
+        CHECK(42 == other.foo());
+    }
+
+    SECTION("When used concurrently, all threads agree on a single mock.")
+    {
+        std::array<Mock<int()>*, 4u> mocks{};
+        {
+            std::vector<std::jthread> threads{};
+            for (auto& mock : mocks)
+            {
+                threads.emplace_back([&] { mock = std::addressof(object.foo_.get()); });
+            }
+        }
+
+        for (Mock<int()> const* const mock : mocks)
+        {
+            CHECK(mock == std::addressof(object.foo_.get()));
+        }
+    }
+}
+
 TEST_CASE(
     "MIMICPP_MOCK_METHOD_WITH_THIS generates a mock with explicit *this* param.",
     "[mock][mock::interface]")
@@ -650,84 +835,84 @@ TEST_CASE(
 
     SECTION("Mocking an unqualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type*)>, decltype(Type::foo_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type*)>, decltype(Type::foo_)>);
         SCOPED_EXP object.foo_.expect_call(&object);
         REQUIRE_NOTHROW(object.foo());
     }
 
     SECTION("Mocking const qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type const*) const>, decltype(Type::foo_const_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type const*) const>, decltype(Type::foo_const_)>);
         SCOPED_EXP std::as_const(object).foo_const_.expect_call(&object);
         REQUIRE_NOTHROW(std::as_const(object).foo_const());
     }
 
     SECTION("Mocking lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type*)&>, decltype(Type::foo_lvalue_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type*)&>, decltype(Type::foo_lvalue_)>);
         SCOPED_EXP object.foo_lvalue_.expect_call(&object);
         REQUIRE_NOTHROW(object.foo_lvalue());
     }
 
     SECTION("Mocking const lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type const*) const&>, decltype(Type::foo_lvalue_const_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type const*) const&>, decltype(Type::foo_lvalue_const_)>);
         SCOPED_EXP std::as_const(object).foo_lvalue_const_.expect_call(&object);
         REQUIRE_NOTHROW(std::as_const(object).foo_lvalue_const());
     }
 
     SECTION("Mocking rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type*) &&>, decltype(Type::foo_rvalue_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type*) &&>, decltype(Type::foo_rvalue_)>);
         SCOPED_EXP std::move(object).foo_rvalue_.expect_call(&object);
         REQUIRE_NOTHROW(std::move(object).foo_rvalue());
     }
 
     SECTION("Mocking const rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type const*) const&&>, decltype(Type::foo_rvalue_const_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type const*) const&&>, decltype(Type::foo_rvalue_const_)>);
         SCOPED_EXP std::move(std::as_const(object)).foo_rvalue_const_.expect_call(&object);
         REQUIRE_NOTHROW(std::move(std::as_const(object)).foo_rvalue_const());
     }
 
     SECTION("Mocking a noexcept member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type*) noexcept>, decltype(Type::foo_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type*) noexcept>, decltype(Type::foo_noexcept_)>);
         SCOPED_EXP object.foo_noexcept_.expect_call(&object);
         REQUIRE_NOTHROW(object.foo_noexcept());
     }
 
     SECTION("Mocking noexcept const qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type const*) const noexcept>, decltype(Type::foo_const_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type const*) const noexcept>, decltype(Type::foo_const_noexcept_)>);
         SCOPED_EXP std::as_const(object).foo_const_noexcept_.expect_call(&object);
         REQUIRE_NOTHROW(std::as_const(object).foo_const_noexcept());
     }
 
     SECTION("Mocking noexcept lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type*) & noexcept>, decltype(Type::foo_lvalue_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type*) & noexcept>, decltype(Type::foo_lvalue_noexcept_)>);
         SCOPED_EXP object.foo_lvalue_noexcept_.expect_call(&object);
         REQUIRE_NOTHROW(object.foo_lvalue_noexcept());
     }
 
     SECTION("Mocking noexcept const lvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type const*) const & noexcept>, decltype(Type::foo_lvalue_const_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type const*) const & noexcept>, decltype(Type::foo_lvalue_const_noexcept_)>);
         SCOPED_EXP std::as_const(object).foo_lvalue_const_noexcept_.expect_call(&object);
         REQUIRE_NOTHROW(std::as_const(object).foo_lvalue_const_noexcept());
     }
 
     SECTION("Mocking noexcept rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type*) && noexcept>, decltype(Type::foo_rvalue_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type*) && noexcept>, decltype(Type::foo_rvalue_noexcept_)>);
         SCOPED_EXP std::move(object).foo_rvalue_noexcept_.expect_call(&object);
         REQUIRE_NOTHROW(std::move(object).foo_rvalue_noexcept());
     }
 
     SECTION("Mocking noexcept const rvalue qualified member function.")
     {
-        STATIC_REQUIRE(std::same_as<Mock<void(Type const*) const && noexcept>, decltype(Type::foo_rvalue_const_noexcept_)>);
+        STATIC_REQUIRE(std::same_as<facade::LazyMock<void(Type const*) const && noexcept>, decltype(Type::foo_rvalue_const_noexcept_)>);
         SCOPED_EXP std::move(std::as_const(object)).foo_rvalue_const_noexcept_.expect_call(&object);
         REQUIRE_NOTHROW(std::move(std::as_const(object)).foo_rvalue_const_noexcept());
     }
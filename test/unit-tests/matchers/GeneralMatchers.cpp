@@ -7,6 +7,9 @@
 
 #include <TestTypes.hpp>
 
+#include <functional>
+#include <optional>
+
 using namespace mimicpp;
 
 namespace
@@ -244,6 +247,47 @@ TEST_CASE(
     }
 }
 
+TEST_CASE(
+    "matches::eq provides the hash of the expected value, when the target type is hashable.",
+    "[matcher]")
+{
+    SECTION("When the target type is the stored type.")
+    {
+        auto const matcher = matches::eq(42);
+
+        CHECK(std::hash<int>{}(42) == matcher.equality_hash<int>());
+        CHECK(std::hash<int>{}(42) == matcher.equality_hash<int const&>());
+    }
+
+    SECTION("When the target type differs from the stored type.")
+    {
+        auto const matcher = matches::eq(42);
+
+        CHECK(std::nullopt == matcher.equality_hash<long>());
+    }
+
+    SECTION("When the stored type is a floating-point type.")
+    {
+        auto const matcher = matches::eq(4.2);
+
+        CHECK(std::nullopt == matcher.equality_hash<double>());
+    }
+
+    SECTION("When the matcher has been inverted.")
+    {
+        auto const matcher = !matches::eq(42);
+
+        CHECK(std::nullopt == matcher.equality_hash<int>());
+    }
+
+    SECTION("When any other predicate is used.")
+    {
+        auto const matcher = matches::ne(42);
+
+        CHECK(std::nullopt == matcher.equality_hash<int>());
+    }
+}
+
 TEST_CASE(
     "matches::ne matches when target value does not compare equal to the stored one.",
     "[matcher]")
@@ -10,6 +10,9 @@
 
 #include "TestTypes.hpp"
 
+#include <functional>
+#include <optional>
+
 using namespace mimicpp;
 
 TEST_CASE(
@@ -223,6 +226,41 @@ TEST_CASE(
     }
 }
 
+TEST_CASE(
+    "expectation_policies::ArgsRequirement provides an index-key for plain equality-requirements on the first argument.",
+    "[expectation][expectation::policy]")
+{
+    using SignatureT = void(int, int);
+
+    SECTION("When the first argument is compared for equality.")
+    {
+        auto const policy = expect::arg<0>(matches::eq(42));
+
+        CHECK(std::hash<int>{}(42) == policy.index_key<SignatureT>());
+    }
+
+    SECTION("When any other argument is compared for equality.")
+    {
+        auto const policy = expect::arg<1>(matches::eq(42));
+
+        CHECK(std::nullopt == policy.index_key<SignatureT>());
+    }
+
+    SECTION("When the first argument is projected.")
+    {
+        auto const policy = expect::arg<0>(matches::eq(42), std::negate{});
+
+        CHECK(std::nullopt == policy.index_key<SignatureT>());
+    }
+
+    SECTION("When any other matcher is used.")
+    {
+        auto const policy = expect::arg<0>(matches::_);
+
+        CHECK(std::nullopt == policy.index_key<SignatureT>());
+    }
+}
+
 TEST_CASE(
     "expect::arg creates an expectation_policies::ArgRequirement policy.",
     "[expectation][expectation::factories]")
@@ -8,6 +8,10 @@
 #include "TestReporter.hpp"
 #include "TestTypes.hpp"
 
+#include <array>
+#include <span>
+#include <vector>
+
 using namespace mimicpp;
 using reporting::control_state_t;
 using reporting::state_applicable;
@@ -1128,3 +1132,105 @@ TEST_CASE(
         expect::times(limit),
         std::invalid_argument);
 }
+
+TEST_CASE(
+    "ControlPolicy::sequence_ratings writes the ratings into the given buffer.",
+    "[expectation][expectation::control][sequence]")
+{
+    namespace Matches = Catch::Matchers;
+
+    ScopedReporter reporter{};
+    TestSequence sequence1{};
+    TestSequence sequence2{};
+
+    ControlPolicy const policy{
+        {},
+        expect::once(),
+        expect::in_sequences(sequence1, sequence2)};
+    std::vector const expectedRatings = std::get<state_applicable>(policy.state()).sequenceRatings;
+
+    SECTION("When the buffer is large enough.")
+    {
+        std::array<sequence::rating, 3u> buffer{};
+        REQUIRE(2u == policy.sequence_ratings(buffer));
+        REQUIRE_THAT(
+            std::span{buffer}.first(2u),
+            Matches::RangeEquals(expectedRatings));
+    }
+
+    SECTION("When the buffer is too small, it's left untouched.")
+    {
+        std::array<sequence::rating, 1u> buffer{};
+        REQUIRE(2u == policy.sequence_ratings(buffer));
+        REQUIRE(sequence::rating{} == buffer[0]);
+    }
+}
+
+TEST_CASE(
+    "ControlPolicy::sequence_ratings is a no-op, when no sequence is attached.",
+    "[expectation][expectation::control]")
+{
+    ControlPolicy const policy{
+        {},
+        expect::once(),
+        sequence::detail::Config<>{}};
+
+    REQUIRE(0u == policy.sequence_ratings({}));
+}
+
+TEST_CASE(
+    "ControlPolicy::strict_sequence_position returns the position within the only sequence, when an exact limit is given.",
+    "[expectation][expectation::control][sequence]")
+{
+    ScopedReporter reporter{};
+    TestSequence mainSequence{};
+
+    ControlPolicy const first{
+        {},
+        expect::once(),
+        expect::in_sequence(mainSequence)};
+    ControlPolicy const second{
+        {},
+        expect::twice(),
+        expect::in_sequence(mainSequence)};
+
+    CHECK(sequence::position{mainSequence.tag(), 0} == first.strict_sequence_position());
+    CHECK(sequence::position{mainSequence.tag(), 1} == second.strict_sequence_position());
+
+    SECTION("When a limit-range is given, no position is returned.")
+    {
+        auto const times = GENERATE(
+            expect::never(),
+            expect::at_most(1),
+            expect::times(1, 2));
+
+        ControlPolicy const policy{
+            {},
+            times,
+            expect::in_sequence(mainSequence)};
+
+        CHECK(std::nullopt == policy.strict_sequence_position());
+    }
+
+    SECTION("When multiple sequences are attached, no position is returned.")
+    {
+        TestSequence otherSequence{};
+
+        ControlPolicy const policy{
+            {},
+            expect::once(),
+            expect::in_sequences(mainSequence, otherSequence)};
+
+        CHECK(std::nullopt == policy.strict_sequence_position());
+    }
+
+    SECTION("When no sequence is attached, no position is returned.")
+    {
+        ControlPolicy const policy{
+            {},
+            expect::once(),
+            sequence::detail::Config<>{}};
+
+        CHECK(std::nullopt == policy.strict_sequence_position());
+    }
+}
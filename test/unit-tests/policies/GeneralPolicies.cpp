@@ -66,6 +66,11 @@ TEMPLATE_TEST_CASE_SIG(
         REQUIRE(policy.is_satisfied());
     }
 
+    SECTION("Policy exposes the expected category.")
+    {
+        STATIC_REQUIRE(category == policy.expected_category());
+    }
+
     SECTION("Policy description.")
     {
         std::optional<StringT> const description = policy.describe();
@@ -127,6 +132,11 @@ TEMPLATE_TEST_CASE_SIG(
         REQUIRE(policy.is_satisfied());
     }
 
+    SECTION("Policy exposes the expected constness.")
+    {
+        STATIC_REQUIRE(constness == policy.expected_constness());
+    }
+
     SECTION("Policy description.")
     {
         std::optional<StringT> const description = policy.describe();
@@ -168,3 +178,25 @@ TEMPLATE_TEST_CASE_SIG(
         }
     }
 }
+
+TEST_CASE(
+    "expect::as_fallback creates a policy, which marks the expectation as fallback.",
+    "[expectation][expectation::policy]")
+{
+    using SignatureT = void();
+    using CallInfoT = call::info_for_signature_t<SignatureT>;
+    using PolicyT = expectation_policies::Fallback;
+    STATIC_REQUIRE(expectation_policy_for<PolicyT, SignatureT>);
+
+    constexpr PolicyT policy = expect::as_fallback();
+    STATIC_REQUIRE(policy.is_fallback());
+    STATIC_REQUIRE(policy.is_satisfied());
+    CHECK(!std::optional<StringT>{policy.describe()});
+
+    const CallInfoT call{
+        .args = {},
+        .fromCategory = GENERATE(from_range(refQualifiers)),
+        .fromConstness = GENERATE(from_range(constQualifiers))};
+    CHECK(policy.matches(call));
+    CHECK_NOTHROW(policy.consume(call));
+}
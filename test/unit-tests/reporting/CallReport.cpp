@@ -17,8 +17,8 @@ namespace
     TargetReport make_common_target_report()
     {
         return TargetReport{
-            .name = "Mock-Name",
-            .overloadReport = TypeReport::make<Signature>()};
+            "Mock-Name",
+            TypeReport::make<Signature>()};
     }
 }
 
@@ -71,7 +71,7 @@ TEST_CASE(
     {
         CallReport second{first};
 
-        second.target.name = "Other Mock";
+        second.target = TargetReport{"Other Mock", first.target.overload_report()};
 
         CHECK(first != second);
         CHECK(second != first);
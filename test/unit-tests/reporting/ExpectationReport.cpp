@@ -276,7 +276,7 @@ TEST_CASE(
     SECTION("When TargetReport differs, reports do not compare equal.")
     {
         reporting::ExpectationReport second{first};
-        second.target.name = "other mock-name";
+        second.target = reporting::TargetReport{"other mock-name", first.target.overload_report()};
 
         CHECK_FALSE(first == second);
         CHECK_FALSE(second == first);
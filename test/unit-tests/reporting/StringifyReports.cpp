@@ -25,8 +25,8 @@ namespace
     reporting::TargetReport make_common_target_report(StringT name = "Mock-Name")
     {
         return reporting::TargetReport{
-            .name = std::move(name),
-            .overloadReport = reporting::TypeReport::make<Signature>()};
+            std::move(name),
+            reporting::TypeReport::make<Signature>()};
     }
 }
 
@@ -673,6 +673,25 @@ TEST_CASE(
         Catch::Matchers::Matches(regex));
 }
 
+TEST_CASE(
+    "reporting::stringify_unfulfilled_expectation mentions the row-index of feed expectations.",
+    "[reporting]")
+{
+    reporting::ExpectationReport const expectationReport{
+        .target = make_common_target_report<void()>(),
+        .controlReport = reporting::state_applicable{.min = 1, .max = 1, .count = 0},
+        .rowIndex = 42u};
+
+    auto const text = reporting::stringify_unfulfilled_expectation(expectationReport);
+    CHECK_THAT(
+        text,
+        Catch::Matchers::Matches(
+            R"(Unfulfilled Expectation defined at `.+:\d+`, `.+` \(row 42\)
+	Of Target `Mock-Name` related to Overload `void\(\)`
+	Because matching exactly once was expected => requires 1 further match\(es\)\.
+)"));
+}
+
 TEST_CASE(
     "reporting::stringify_unhandled_exception converts the information to a pretty formatted text.",
     "[reporting]")
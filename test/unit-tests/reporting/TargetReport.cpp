@@ -5,6 +5,8 @@
 
 #include "mimic++/reporting/TargetReport.hpp"
 
+#include <stdexcept>
+
 using namespace mimicpp;
 
 TEST_CASE(
@@ -12,8 +14,8 @@ TEST_CASE(
     "[reporting]")
 {
     reporting::TargetReport const target{
-        .name = "Test mock",
-        .overloadReport = reporting::TypeReport::make<void()>()};
+        "Test mock",
+        reporting::TypeReport::make<void()>()};
 
     SECTION("Compares equal, when both sides are equal.")
     {
@@ -27,8 +29,7 @@ TEST_CASE(
 
     SECTION("Compares unequal, when name differs.")
     {
-        reporting::TargetReport other{target};
-        other.name = "Other test mock";
+        reporting::TargetReport const other{"Other test mock", target.overload_report()};
 
         REQUIRE_FALSE(other == target);
         REQUIRE_FALSE(target == other);
@@ -38,8 +39,7 @@ TEST_CASE(
 
     SECTION("Compares unequal, when name differs.")
     {
-        reporting::TargetReport other{target};
-        other.overloadReport = reporting::TypeReport::make<void() const>();
+        reporting::TargetReport const other{target.name(), reporting::TypeReport::make<void() const>()};
 
         REQUIRE_FALSE(other == target);
         REQUIRE_FALSE(target == other);
@@ -47,3 +47,34 @@ TEST_CASE(
         REQUIRE(target != other);
     }
 }
+
+TEST_CASE(
+    "reporting::TargetReport copies share the same record.",
+    "[reporting]")
+{
+    reporting::TargetReport const target{
+        "Test mock",
+        reporting::TypeReport::make<void()>()};
+    reporting::TargetReport const copy{target};
+
+    CHECK_THAT(
+        copy.name(),
+        Catch::Matchers::Equals("Test mock"));
+    CHECK(reporting::TypeReport::make<void()>() == copy.overload_report());
+    CHECK(std::addressof(target.name()) == std::addressof(copy.name()));
+}
+
+TEST_CASE(
+    "reporting::TargetReport falls back to a fixed name, when the name-generator throws.",
+    "[reporting]")
+{
+    reporting::TargetReport const target{
+        [](StringViewT const) -> StringT { throw std::runtime_error{"Generator failed."}; },
+        "Test mock",
+        reporting::TypeReport::make<void()>()};
+
+    CHECK_THAT(
+        target.name(),
+        Catch::Matchers::Equals("unnamed-mock"));
+    CHECK(std::addressof(target.name()) == std::addressof(target.name()));
+}
@@ -0,0 +1,121 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/utilities/AffineMutex.hpp"
+
+#include "TestReporter.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "util::detail::AffineMutex synchronizes by default.",
+    "[utility]")
+{
+    util::detail::AffineMutex<std::shared_mutex> mutex{};
+    CHECK(!mutex.is_confined());
+
+    // Locking the same mutex twice from a single thread is undefined, thus the attempts are made from another thread.
+    auto const tryFromOtherThread = [&](auto op) {
+        bool result{};
+        std::thread{[&] { result = op(); }}.join();
+        return result;
+    };
+
+    SECTION("When exclusively locked.")
+    {
+        std::unique_lock const lock{mutex};
+
+        CHECK(!tryFromOtherThread([&] { return mutex.try_lock(); }));
+        CHECK(!tryFromOtherThread([&] { return mutex.try_lock_shared(); }));
+    }
+
+    SECTION("When shared-locked.")
+    {
+        std::shared_lock const lock{mutex};
+
+        CHECK(!tryFromOtherThread([&] { return mutex.try_lock(); }));
+        CHECK(tryFromOtherThread([&] {
+            bool const locked = mutex.try_lock_shared();
+            if (locked)
+            {
+                mutex.unlock_shared();
+            }
+
+            return locked;
+        }));
+    }
+}
+
+TEST_CASE(
+    "util::detail::AffineMutex skips synchronization, when bound to its owner.",
+    "[utility]")
+{
+    util::detail::AffineMutex<std::shared_mutex> mutex{ThreadAffinity::owner};
+    CHECK(mutex.is_confined());
+
+    SECTION("When exclusively locked.")
+    {
+        std::unique_lock const lock{mutex};
+
+        CHECK(mutex.try_lock());
+        CHECK(mutex.try_lock_shared());
+    }
+
+    SECTION("When shared-locked.")
+    {
+        std::shared_lock const lock{mutex};
+
+        CHECK(mutex.try_lock());
+        CHECK(mutex.try_lock_shared());
+    }
+}
+
+#ifndef NDEBUG
+
+TEST_CASE(
+    "util::detail::AffineMutex reports usages from foreign threads, when bound to its owner.",
+    "[utility]")
+{
+    ScopedReporter reporter{};
+    util::detail::AffineMutex<std::shared_mutex> mutex{ThreadAffinity::owner};
+
+    SECTION("When used from the owner, nothing is reported.")
+    {
+        {
+            std::unique_lock const lock{mutex};
+        }
+
+        {
+            std::shared_lock const lock{mutex};
+        }
+
+        CHECK_THAT(
+            reporter.errors(),
+            Catch::Matchers::IsEmpty());
+    }
+
+    SECTION("When used from another thread, each operation is reported.")
+    {
+        std::thread{[&] {
+            {
+                std::unique_lock const lock{mutex};
+            }
+
+            {
+                std::shared_lock const lock{mutex};
+            }
+        }}.join();
+
+        CHECK_THAT(
+            reporter.errors(),
+            Catch::Matchers::SizeIs(2u));
+    }
+}
+
+#endif
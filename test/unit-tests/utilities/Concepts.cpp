@@ -5,6 +5,7 @@
 
 #include "mimic++/utilities/Concepts.hpp"
 
+#include <string>
 #include <type_traits>
 
 using namespace mimicpp;
@@ -34,3 +35,23 @@ TEMPLATE_TEST_CASE_SIG(
 {
     STATIC_REQUIRE(expected == util::same_as_any<T, Others...>);
 }
+
+namespace
+{
+    struct non_hashable
+    {
+    };
+}
+
+TEMPLATE_TEST_CASE_SIG(
+    "hashable determines, whether T has an enabled std::hash specialization.",
+    "[utility]",
+    ((bool expected, typename T), expected, T),
+    (false, non_hashable),
+    (true, int),
+    (true, int*),
+    (true, double),
+    (true, std::string))
+{
+    STATIC_REQUIRE(expected == util::hashable<T>);
+}
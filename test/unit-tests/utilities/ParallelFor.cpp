@@ -0,0 +1,79 @@
+//          Copyright Dominic (DNKpp) Koepke 2024 - 2025.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+
+#include "mimic++/utilities/ParallelFor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace mimicpp;
+
+TEST_CASE(
+    "util::detail::parallel_for invokes the function exactly once for each index.",
+    "[utility]")
+{
+    std::size_t const count = GENERATE(0u, 1u, 7u, 1000u);
+    std::size_t const workers = GENERATE(0u, 1u, 2u, 8u);
+
+    std::vector<std::atomic_int> invocations(count);
+    util::detail::parallel_for(
+        count,
+        workers,
+        [&](std::size_t const i) { ++invocations[i]; });
+
+    CHECK(std::ranges::all_of(invocations, [](auto const& n) { return 1 == n; }));
+}
+
+TEST_CASE(
+    "util::detail::parallel_for supports nested invocations.",
+    "[utility]")
+{
+    std::size_t const workers = GENERATE(2u, 8u);
+
+    std::vector<std::atomic_int> invocations(100u * 100u);
+    util::detail::parallel_for(
+        100u,
+        workers,
+        [&](std::size_t const i) {
+            util::detail::parallel_for(
+                100u,
+                workers,
+                [&](std::size_t const j) { ++invocations[i * 100u + j]; });
+        });
+
+    CHECK(std::ranges::all_of(invocations, [](auto const& n) { return 1 == n; }));
+}
+
+TEST_CASE(
+    "util::detail::WorkerPool reuses its threads.",
+    "[utility]")
+{
+    util::detail::WorkerPool pool{};
+
+    std::mutex threadIdsMx{};
+    std::set<std::thread::id> threadIds{};
+    std::atomic_int invocations{};
+    auto work = [&]() noexcept {
+        ++invocations;
+        std::scoped_lock const lock{threadIdsMx};
+        threadIds.emplace(std::this_thread::get_id());
+    };
+
+    for (int i{0}; i < 100; ++i)
+    {
+        util::detail::WorkerPool::Job job{work};
+        pool.run(job, 3u);
+    }
+
+    // The calling thread always participates; each helper may or may not have picked up the job.
+    CHECK(100 <= invocations);
+    CHECK(400 >= invocations);
+    CHECK(threadIds.contains(std::this_thread::get_id()));
+    CHECK(4u >= threadIds.size());
+}